@@ -43,6 +43,7 @@ def _cleanCacheDirectory(cache_name, cache_dir):
 def cleanCaches():
     _cleanCacheDirectory("ccache", os.path.join(getCacheDir(), "ccache"))
     _cleanCacheDirectory("clcache", os.path.join(getCacheDir(), "clcache"))
+    _cleanCacheDirectory("runtime", os.path.join(getCacheDir(), "runtime"))
     _cleanCacheDirectory("bytecode", getBytecodeCacheDir())
     _cleanCacheDirectory(
         "dll-dependencies", os.path.join(getCacheDir(), "library_dependencies")
@@ -602,6 +602,9 @@ def runSconsBackend():
     if Options.isLowMemory():
         options["low_memory"] = asBoolStr(True)
 
+    if not Options.shallCheckConstantsChecksum():
+        options["constants_checksum"] = asBoolStr(False)
+
     if not Options.shallMakeModule():
         options["result_exe"] = OutputDirectories.getResultFullpath(onefile=False)
 
@@ -881,6 +884,8 @@ def compileTree():
     if Options.is_debug:
         Reports.doMissingOptimizationReport()
 
+    Reports.doUnboxedVariablesReport()
+
     if Options.shallNotDoExecCCompilerCall():
         return True, {}
 
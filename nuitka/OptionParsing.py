@@ -366,7 +366,8 @@ onefile_group.add_option(
     help="""\
 When creating the onefile, use an archive format, that can be unpacked
 with "nuitka-onefile-unpack" rather than a stream that only the onefile
-program itself unpacks. Default is off.""",
+program itself unpacks. Files are stored independently, which allows them
+to be unpacked in parallel at startup, but compresses worse. Default is off.""",
 )
 
 del onefile_group
@@ -646,6 +647,17 @@ deduce the value of "__package__", to be fully compatible. The value "original"
 is incompatible for modules that normally can be loaded into any package.""",
 )
 
+compilation_group.add_option(
+    "--disable-constants-checksum",
+    action="store_false",
+    dest="constants_checksum",
+    default=True,
+    help="""\
+Do not verify the CRC32 checksums of the constants blob parts when they get
+loaded at run time. Only use this for deployments where the integrity of the
+binary is ensured otherwise, e.g. by code signing. Defaults to off.""",
+)
+
 
 del compilation_group
 
@@ -957,7 +969,7 @@ del c_compiler_group
 
 caching_group = parser.add_option_group("Cache Control")
 
-_cache_names = ("all", "ccache", "bytecode", "compression")
+_cache_names = ("all", "ccache", "bytecode", "compression", "runtime")
 
 if isWin32Windows():
     _cache_names += ("dll-dependencies",)
@@ -1504,6 +1504,11 @@ def shallDisableCCacheUsage():
     return shallDisableCacheUsage("ccache")
 
 
+def shallDisableRuntimeCacheUsage():
+    """:returns: bool derived from ``--disable-cache=runtime``"""
+    return shallDisableCacheUsage("runtime")
+
+
 def shallDisableBytecodeCacheUsage():
     """:returns: bool derived from ``--disable-bytecode-cache``"""
     return shallDisableCacheUsage("bytecode")
@@ -2116,6 +2121,11 @@ def shallShowSourceModifications():
     return options is not None and options.show_source_changes
 
 
+def shallCheckConstantsChecksum():
+    """:returns: bool derived from ``--disable-constants-checksum``"""
+    return options.constants_checksum
+
+
 def isLowMemory():
     """*bool* low memory usage requested"""
     return options.low_memory
@@ -27,7 +27,10 @@ from abc import abstractmethod
 
 from nuitka.__past__ import getMetaClassBase, iterItems
 from nuitka.nodes.shapes.BuiltinTypeShapes import tshape_dict
-from nuitka.nodes.shapes.StandardShapes import tshape_unknown
+from nuitka.nodes.shapes.StandardShapes import (
+    tshape_uninitialized,
+    tshape_unknown,
+)
 from nuitka.utils import Utils
 from nuitka.utils.InstanceCounters import (
     counted_del,
@@ -260,7 +263,7 @@ class Variable(getMetaClassBase("Variable")):
             elif trace.isUnknownTrace():
                 result.add(tshape_unknown)
             elif trace.isEscapeTrace():
-                result.add(tshape_unknown)
+                result.add(trace.getTypeShape())
             elif trace.isInitTrace():
                 result.add(tshape_unknown)
             elif trace.isUnassignedTrace():
@@ -270,11 +273,31 @@ class Variable(getMetaClassBase("Variable")):
             # TODO: Remove this and be not unknown.
             elif trace.isLoopTrace():
                 trace.getTypeShape().emitAlternatives(result.add)
+                result.discard(tshape_uninitialized)
             else:
                 assert False, trace
 
         return result
 
+    def mustHaveValueWhenRead(self):
+        """Check if all reads of the variable must find it assigned.
+
+        Deleting the variable makes us give up on it, even if the deleted
+        value is not read.
+        """
+
+        for trace in self.traces:
+            if trace.isDeletedTrace():
+                return False
+
+            if (
+                not trace.mustHaveValue()
+                and trace.getUsageCount() > trace.getMergeUsageCount()
+            ):
+                return False
+
+        return True
+
     @staticmethod
     def onControlFlowEscape(trace_collection):
         """Mark the variable as escaped or unknown, or keep it depending on variable type."""
@@ -24,25 +24,33 @@ import os
 import platform
 import re
 import sys
+import time
 from collections import defaultdict
 
 from nuitka.Tracing import scons_details_logger, scons_logger
 from nuitka.utils.AppDirs import getCacheDir
 from nuitka.utils.Download import getCachedDownload
+from nuitka.utils.Execution import executeProcess
 from nuitka.utils.FileOperations import (
     areSamePaths,
+    copyFile,
+    deleteFile,
     getExternalUsePath,
     getFileContentByLine,
     getFileContents,
+    getFileList,
     getLinkTarget,
     makePath,
+    replaceFileAtomic,
 )
+from nuitka.utils.Hashing import Hash
 from nuitka.utils.Importing import importFromInlineCopy
 from nuitka.utils.Utils import hasMacOSIntelSupport, isMacOS, isWin32Windows
 
 from .SconsProgress import updateSconsProgressBar
 from .SconsUtils import (
     getExecutablePath,
+    getMsvcVersionString,
     getSconsReportValue,
     setEnvironmentVariable,
 )
@@ -436,3 +444,201 @@ def runClCache(args, env):
     updateSconsProgressBar()
 
     return result
+
+
+# Keep this many runtime objects in the cache, and not for longer than this.
+_runtime_cache_max_entries = 32
+_runtime_cache_max_age = 30 * 24 * 3600
+
+_compiler_identity_cache = {}
+
+
+def _getCompilerIdentity(env):
+    """Identify the compiler beyond its version number.
+
+    The version number alone, e.g. from "-dumpversion", is not enough, as
+    distribution builds and patched compilers can share it, and for non-gcc
+    compilers there is none at all, so the full version output is used.
+    """
+    if env.msvc_mode:
+        return "cl %s" % getMsvcVersionString(env)
+
+    compiler_path = getExecutablePath(env.the_compiler, env) or env.the_compiler
+
+    if compiler_path not in _compiler_identity_cache:
+        stdout, stderr, exit_code = executeProcess((compiler_path, "--version"))
+
+        _compiler_identity_cache[compiler_path] = (
+            compiler_path,
+            exit_code,
+            stdout,
+            stderr,
+        )
+
+    return repr(_compiler_identity_cache[compiler_path])
+
+
+def _updateHashFromPythonHeaders(hash_value, env):
+    # The Python version alone does not identify the headers, builds with
+    # different configuration or patch level must not share objects.
+    for header_name in ("pyconfig.h", "patchlevel.h"):
+        for include_dir in env["CPPPATH"]:
+            filename = os.path.join(str(include_dir), header_name)
+
+            if os.path.isfile(filename):
+                hash_value.updateFromValues(filename)
+                hash_value.updateFromFile(filename)
+
+                break
+
+
+def _getRuntimeObjectCacheKey(env, source_filename, module_mode, python_version):
+    hash_value = Hash()
+
+    # The compiler and its arguments, except for the file names.
+    if source_filename.endswith(".c"):
+        command = "$SHCC $SHCFLAGS $SHCCFLAGS" if module_mode else "$CC $CFLAGS"
+    else:
+        command = "$SHCXX $SHCXXFLAGS $SHCCFLAGS" if module_mode else "$CXX $CXXFLAGS"
+
+    # The count of frozen modules is only used by the main program, and would
+    # otherwise prevent sharing between programs.
+    command_env = env.Override(
+        {
+            "CPPDEFINES": [
+                cpp_define
+                for cpp_define in env["CPPDEFINES"]
+                if not str(cpp_define).startswith("_NUITKA_FROZEN=")
+            ]
+        }
+    )
+
+    hash_value.updateFromValues(
+        python_version,
+        repr(env.gcc_version),
+        _getCompilerIdentity(env),
+        command_env.subst(command + " $CCFLAGS $_CCCOMCOM"),
+    )
+
+    _updateHashFromPythonHeaders(hash_value, env)
+
+    # The runtime includes all of these, not worth to be more precise.
+    for dirname in ("include", "static_src", os.path.join("inline_copy", "zlib")):
+        dirname = os.path.join(env.nuitka_src, dirname)
+
+        if not os.path.isdir(dirname):
+            continue
+
+        for filename in getFileList(dirname):
+            hash_value.updateFromValues(os.path.relpath(filename, env.nuitka_src))
+            hash_value.updateFromFile(filename)
+
+    # The global constants are the only program specific include, and only
+    # if these are the same, the object can be used.
+    for filename in (
+        "__constants.h",
+        "nuitka_data_decoder.h",
+        "nuitka_file_tracer.h",
+        "nuitka_init_program.h",
+    ):
+        filename = os.path.join(env.source_dir, filename)
+
+        if os.path.exists(filename):
+            hash_value.updateFromValues(os.path.basename(filename))
+            hash_value.updateFromFile(filename)
+
+    return hash_value.asHexDigest()
+
+
+def _trimRuntimeObjectCache(cache_dir):
+    """Remove old runtime objects from the cache.
+
+    Every compiler, flag or Nuitka change creates a new entry, so without
+    this, the cache would only ever grow. Entries are touched when used, so
+    the least recently used ones are removed first.
+    """
+    entries = []
+
+    for filename in getFileList(cache_dir, ignore_suffixes=(".tmp",)):
+        try:
+            entries.append((os.path.getmtime(filename), filename))
+        except OSError:
+            # Removed by a parallel compilation.
+            pass
+
+    entries.sort(reverse=True)
+
+    now = time.time()
+
+    for count, (mtime, filename) in enumerate(entries):
+        if count >= _runtime_cache_max_entries or now - mtime > _runtime_cache_max_age:
+            deleteFile(filename, must_exist=False)
+
+
+def provideCachedRuntimeObject(env, source_filename, module_mode, python_version):
+    """Provide the object file for the compiled runtime from the cache.
+
+    The runtime is a single large C file, that needs no recompilation with
+    the same compiler and arguments, and therefore is shared between all
+    compilations. If not in the cache yet, it is added once compiled.
+
+    Returns:
+        filename of the object file, if it was in the cache, otherwise the
+        object node to compile.
+    """
+
+    object_filename = ".".join(source_filename.split(".")[:-1]) + (
+        ".os" if module_mode and os.name != "nt" else ".o"
+    )
+
+    cache_dir = os.path.join(getCacheDir(), "runtime")
+    cache_filename = os.path.join(
+        cache_dir,
+        _getRuntimeObjectCacheKey(
+            env=env,
+            source_filename=source_filename,
+            module_mode=module_mode,
+            python_version=python_version,
+        )
+        + os.path.splitext(object_filename)[1],
+    )
+
+    if os.path.exists(cache_filename):
+        scons_details_logger.info(
+            "Using cached runtime object '%s' for '%s'."
+            % (cache_filename, source_filename)
+        )
+
+        copyFile(cache_filename, object_filename)
+
+        # Mark as recently used, for the cache trimming.
+        try:
+            os.utime(cache_filename, None)
+        except OSError:
+            pass
+
+        return object_filename
+
+    scons_details_logger.info(
+        "Compiling runtime object '%s' into cache." % source_filename
+    )
+
+    if module_mode:
+        result = env.SharedObject(object_filename, source_filename)
+    else:
+        result = env.Object(object_filename, source_filename)
+
+    def storeRuntimeObject(target, source, env):
+        # Parallel compilations might do this at the same time, so rename
+        # only complete files.
+        makePath(cache_dir)
+
+        tmp_filename = "%s.%d.tmp" % (cache_filename, os.getpid())
+        copyFile(target[0].abspath, tmp_filename)
+        replaceFileAtomic(tmp_filename, cache_filename)
+
+        _trimRuntimeObjectCache(cache_dir)
+
+    env.AddPostAction(result, storeRuntimeObject)
+
+    return result
@@ -55,6 +55,7 @@ from .SconsUtils import (
 # spell-checker: ignore LIBPATH,CPPDEFINES,CPPPATH,CXXVERSION,CCFLAGS,LINKFLAGS,CXXFLAGS
 # spell-checker: ignore -flto,-fpartial-inlining,-freorder-functions,-defsym,-fprofile
 # spell-checker: ignore -fwrapv,-Wunused,fcompare,-ftrack,-fvisibility,-municode,
+# spell-checker: ignore -ffunction-sections,-fdata-sections
 # spell-checker: ignore -feliminate,noexecstack,implib
 # spell-checker: ignore LTCG,GENPROFILE,USEPROFILE,CGTHREADS
 
@@ -762,6 +763,17 @@ def setupCCompiler(env, lto_mode, pgo_mode, job_count, onefile_compile):
     if env.gcc_mode and not env.noelf_mode:
         env.Append(LINKFLAGS=["-z", "noexecstack"])
 
+    # The runtime contains all specialized operation and comparison helpers,
+    # but a program uses only few of them. Put functions and data in their
+    # own sections, so the linker can remove the unused ones, for LTO that
+    # is done already.
+    if env.gcc_mode and not env.noelf_mode and not env.lto_mode:
+        env.Append(CCFLAGS=["-ffunction-sections", "-fdata-sections"])
+        env.Append(LINKFLAGS=["-Wl,--gc-sections"])
+
+    if isMacOS() and env.gcc_mode:
+        env.Append(LINKFLAGS=["-Wl,-dead_strip"])
+
     # For MinGW64 we need to tell the subsystem to target as well as to
     # automatically import everything used.
     if env.mingw_mode:
@@ -412,6 +412,9 @@ def setCommonSconsOptions(options):
     if Options.shallDisableCCacheUsage():
         options["disable_ccache"] = asBoolStr(True)
 
+    if Options.shallDisableRuntimeCacheUsage():
+        options["disable_runtime_cache"] = asBoolStr(True)
+
     if Options.shallDisableConsoleWindow() and Options.mayDisableConsoleWindow():
         options["disable_console"] = asBoolStr(True)
 
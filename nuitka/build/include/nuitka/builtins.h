@@ -59,6 +59,87 @@ NUITKA_MAY_BE_UNUSED static PyObject *LOOKUP_BUILTIN_STR(char const *name) {
     return result;
 }
 
+#if NUITKA_DICT_HAS_VERSION_TAG
+// Snapshot of the built-in values a module reads, indexed by identifiers given
+// at compile time. The values are borrowed from the builtins, and all of them
+// become invalid together once its version tag changes.
+struct Nuitka_BuiltinsSnapshot {
+    uint64_t builtins_dict_version;
+    PyObject **values;
+    Py_ssize_t count;
+};
+
+NUITKA_MAY_BE_UNUSED static PyObject *GET_BUILTINS_SNAPSHOT_VALUE(struct Nuitka_BuiltinsSnapshot *snapshot,
+                                                                  Py_ssize_t builtin_id,
+                                                                  Nuitka_StringObject *var_name) {
+    assert(builtin_id >= 0 && builtin_id < snapshot->count);
+
+    if (unlikely(snapshot->builtins_dict_version != dict_builtin->ma_version_tag)) {
+        memset(snapshot->values, 0, sizeof(PyObject *) * snapshot->count);
+        snapshot->builtins_dict_version = dict_builtin->ma_version_tag;
+    }
+
+    PyObject *result = snapshot->values[builtin_id];
+
+    if (unlikely(result == NULL)) {
+        result = GET_STRING_DICT_VALUE(dict_builtin, var_name);
+        snapshot->values[builtin_id] = result;
+    }
+
+    return result;
+}
+
+// Cache of a module variable read at one place in the code. The value is
+// borrowed from the module dictionary, or from the builtins, and only valid
+// while these do not change, which their version tags tell.
+struct Nuitka_ModuleVariableCache {
+    uint64_t module_dict_version;
+    // Zero unless the value was taken from the builtins.
+    uint64_t builtins_dict_version;
+    PyObject *value;
+};
+
+// For names of built-ins, the module gives its snapshot, so a miss of the cache,
+// e.g. due to any module variable being assigned, doesn't need to look at the
+// built-in dictionary again.
+NUITKA_MAY_BE_UNUSED static PyObject *GET_MODULE_VARIABLE_VALUE_CACHED(PyDictObject *module_dict,
+                                                                      Nuitka_StringObject *var_name,
+                                                                      struct Nuitka_ModuleVariableCache *cache,
+                                                                      struct Nuitka_BuiltinsSnapshot *snapshot,
+                                                                      Py_ssize_t builtin_id) {
+    if (likely(cache->module_dict_version == module_dict->ma_version_tag)) {
+        if (likely(cache->builtins_dict_version == 0 ||
+                   cache->builtins_dict_version == dict_builtin->ma_version_tag)) {
+            return cache->value;
+        }
+    }
+
+    PyObject *result = GET_STRING_DICT_VALUE(module_dict, var_name);
+    uint64_t builtins_dict_version = 0;
+
+    if (result == NULL) {
+        if (snapshot != NULL) {
+            result = GET_BUILTINS_SNAPSHOT_VALUE(snapshot, builtin_id, var_name);
+        } else {
+            result = GET_STRING_DICT_VALUE(dict_builtin, var_name);
+        }
+
+        // Not caching the absence, error exits need not be fast.
+        if (unlikely(result == NULL)) {
+            return NULL;
+        }
+
+        builtins_dict_version = dict_builtin->ma_version_tag;
+    }
+
+    cache->module_dict_version = module_dict->ma_version_tag;
+    cache->builtins_dict_version = builtins_dict_version;
+    cache->value = result;
+
+    return result;
+}
+#endif
+
 extern void _initBuiltinModule(void);
 
 #define NUITKA_DECLARE_BUILTIN(name) extern PyObject *_python_original_builtin_value_##name;
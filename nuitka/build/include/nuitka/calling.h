@@ -105,6 +105,35 @@ NUITKA_MAY_BE_UNUSED static PyObject *CALL_FUNCTION_WITH_POSARGS(PyThreadState *
 extern PyObject *CALL_METHOD_WITH_POSARGS(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
                                           PyObject *positional_args);
 
+// Method call with a cache per call site, see "Nuitka_AttributeCache", for up
+// to 10 arguments. For compiled functions, and with vectorcall also for
+// uncompiled functions and method descriptors, no bound method is created.
+#if PYTHON_VERSION >= 0x300 && PYTHON_VERSION < 0x3b0
+struct Nuitka_AttributeCache;
+
+extern PyObject *CALL_METHOD_WITH_ARGS_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                              PyObject *const *args, Py_ssize_t args_count,
+                                              struct Nuitka_AttributeCache *cache);
+
+#if _DEBUG_REFCOUNTS
+extern int count_hit_method_call_cache;
+extern int count_miss_method_call_cache;
+extern int count_invalidated_method_call_cache;
+extern int count_uncacheable_method_call_cache;
+#endif
+#endif
+
+// Function call with keyword arguments split into values and a names tuple,
+// and a cache per call site, see "Nuitka_KeywordArgsCache", for up to 10
+// positional arguments.
+#if PYTHON_VERSION >= 0x300
+struct Nuitka_KeywordArgsCache;
+
+extern PyObject *CALL_FUNCTION_WITH_ARGS_KWSPLIT_CACHED(PyThreadState *tstate, PyObject *called, PyObject *const *args,
+                                                       Py_ssize_t args_count, PyObject *const *kw_values,
+                                                       PyObject *kw_names, struct Nuitka_KeywordArgsCache *cache);
+#endif
+
 // TODO: Specialize in template too.
 NUITKA_MAY_BE_UNUSED static PyObject *CALL_FUNCTION_WITH_KEYARGS(PyThreadState *tstate, PyObject *function_object,
                                                                  PyObject *named_args) {
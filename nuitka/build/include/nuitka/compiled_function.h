@@ -139,6 +139,25 @@ PyObject *Nuitka_CallFunctionPosArgsKwSplit(PyThreadState *tstate, struct Nuitka
                                             PyObject *const *args, Py_ssize_t args_size, PyObject *const *kw_values,
                                             PyObject *kw_names);
 
+#if PYTHON_VERSION >= 0x300
+// Keyword argument calls with up to this many keywords can use a cache.
+#define NUITKA_KEYWORD_ARGS_CACHE_SIZE 8
+
+// Per call site cache of the parameter index for each keyword name. The names
+// are a constant tuple of the call site, so only the called code can change.
+struct Nuitka_KeywordArgsCache {
+    // A reference, so no other code object can get the same address.
+    PyCodeObject *code_object;
+    Py_ssize_t kw_only_found;
+    Py_ssize_t kw_indexes[NUITKA_KEYWORD_ARGS_CACHE_SIZE];
+};
+
+PyObject *Nuitka_CallFunctionPosArgsKwSplitCached(PyThreadState *tstate, struct Nuitka_FunctionObject const *function,
+                                                  PyObject *const *args, Py_ssize_t args_size,
+                                                  PyObject *const *kw_values, PyObject *kw_names,
+                                                  struct Nuitka_KeywordArgsCache *cache);
+#endif
+
 PyObject *Nuitka_CallMethodFunctionNoArgs(PyThreadState *tstate, struct Nuitka_FunctionObject const *function,
                                           PyObject *object);
 PyObject *Nuitka_CallMethodFunctionPosArgs(PyThreadState *tstate, struct Nuitka_FunctionObject const *function,
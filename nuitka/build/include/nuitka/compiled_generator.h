@@ -226,11 +226,6 @@ static inline void RESTORE_GENERATOR_EXCEPTION(PyThreadState *tstate, struct Nui
 #endif
 }
 
-// Functions to preserver and restore from heap area temporary values during
-// yield/yield from/await exits of generator functions.
-extern void Nuitka_PreserveHeap(void *dest, ...);
-extern void Nuitka_RestoreHeap(void *source, ...);
-
 NUITKA_MAY_BE_UNUSED static void STORE_GENERATOR_EXCEPTION(PyThreadState *tstate,
                                                            struct Nuitka_GeneratorObject *generator) {
 #if PYTHON_VERSION < 0x3b0
@@ -29,6 +29,41 @@ static const bool use_freelists = false;
 static const bool use_freelists = true;
 #endif
 
+// The free lists are file static globals, protected by the GIL. Without a
+// GIL, they are thread local instead, and released when the thread exits.
+// Their sizes are limited by "MAX_*_FREE_LIST_COUNT" values, which can be
+// changed at build time, e.g. "CPPFLAGS=-DMAX_FRAME_FREE_LIST_COUNT=1000".
+#if defined(PY_NOGIL)
+#define NUITKA_THREAD_LOCAL_FREELISTS 1
+#else
+#define NUITKA_THREAD_LOCAL_FREELISTS 0
+#endif
+
+#if NUITKA_THREAD_LOCAL_FREELISTS
+#if defined(_MSC_VER)
+#define NUITKA_FREELIST_THREAD_LOCAL __declspec(thread)
+#else
+#define NUITKA_FREELIST_THREAD_LOCAL __thread
+#endif
+#define NUITKA_FREELIST_STORAGE static NUITKA_FREELIST_THREAD_LOCAL
+
+// Arrange for the thread local free lists to be released at thread exit.
+extern NUITKA_FREELIST_THREAD_LOCAL bool Nuitka_free_lists_release_registered;
+extern void Nuitka_RegisterThreadFreeListsRelease(void);
+
+#define _registerFreeListsRelease()                                                                                    \
+    if (unlikely(Nuitka_free_lists_release_registered == false)) {                                                    \
+        Nuitka_RegisterThreadFreeListsRelease();                                                                       \
+    }
+#else
+#define NUITKA_FREELIST_STORAGE static
+#define _registerFreeListsRelease()
+#endif
+
+#define NUITKA_DECLARE_FREELIST(free_list, object_type)                                                                \
+    NUITKA_FREELIST_STORAGE object_type *free_list = NULL;                                                             \
+    NUITKA_FREELIST_STORAGE int free_list##_count = 0
+
 #define allocateFromFreeList(free_list, object_type, type_type, size)                                                  \
     if (free_list != NULL) {                                                                                           \
         result = free_list;                                                                                            \
@@ -61,6 +96,7 @@ static const bool use_freelists = true;
     CHECK_OBJECT(result);
 
 #define releaseToFreeList(free_list, object, max_free_list_count)                                                      \
+    _registerFreeListsRelease();                                                                                       \
     if (free_list != NULL || max_free_list_count == 0 || use_freelists == false) {                                     \
         if (free_list##_count >= max_free_list_count) {                                                                \
             PyObject_GC_Del(object);                                                                                   \
@@ -79,4 +115,129 @@ static const bool use_freelists = true;
         free_list##_count += 1;                                                                                        \
     }
 
+#define releaseAllFromFreeList(free_list, object_type)                                                                 \
+    while (free_list != NULL) {                                                                                        \
+        object_type *object = free_list;                                                                               \
+        free_list = *((object_type **)free_list);                                                                      \
+        PyObject_GC_Del(object);                                                                                       \
+    }                                                                                                                  \
+    free_list##_count = 0;
+
+
+// Free lists for variable size objects, split into bins by size, starting at
+// a minimum size and doubling from there. Objects are allocated with the full
+// size of their bin, so an object taken from a bin never needs to be resized.
+// Only the last bin is open ended, and might resize. The limit on the count
+// applies per bin.
+#define NUITKA_FREELIST_BINS 8
+
+NUITKA_MAY_BE_UNUSED static inline int Nuitka_GetFreeListBin(Py_ssize_t size, Py_ssize_t min_size) {
+    if (size <= min_size) {
+        return 0;
+    }
+
+#if defined(__GNUC__)
+    // Index of the highest bit of "size - 1" relative to the minimum size.
+    int bin = (int)(sizeof(unsigned long) * 8 - __builtin_clzl((unsigned long)(size - 1))) -
+              (int)(sizeof(unsigned long) * 8 - __builtin_clzl((unsigned long)min_size)) + 1;
+#else
+    int bin = 1;
+    Py_ssize_t bin_size = min_size << 1;
+
+    while (size > bin_size && bin < NUITKA_FREELIST_BINS - 1) {
+        bin_size <<= 1;
+        bin += 1;
+    }
+#endif
+
+    return bin < NUITKA_FREELIST_BINS - 1 ? bin : NUITKA_FREELIST_BINS - 1;
+}
+
+NUITKA_MAY_BE_UNUSED static Py_ssize_t Nuitka_GetFreeListBinSize(int bin, Py_ssize_t size, Py_ssize_t min_size) {
+    if (bin == NUITKA_FREELIST_BINS - 1) {
+        return size;
+    }
+
+    return min_size << bin;
+}
+
+// For reporting about the bins usage.
+#if _DEBUG_REFCOUNTS
+#define _countFreeListBinHit(free_list, bin) count_hit_##free_list[bin] += 1
+#define _countFreeListBinMiss(free_list, bin) count_miss_##free_list[bin] += 1
+
+extern int count_hit_free_list_frames[NUITKA_FREELIST_BINS];
+extern int count_miss_free_list_frames[NUITKA_FREELIST_BINS];
+extern int count_hit_free_list_generators[NUITKA_FREELIST_BINS];
+extern int count_miss_free_list_generators[NUITKA_FREELIST_BINS];
+#if PYTHON_VERSION >= 0x350
+extern int count_hit_free_list_coros[NUITKA_FREELIST_BINS];
+extern int count_miss_free_list_coros[NUITKA_FREELIST_BINS];
+#endif
+#if PYTHON_VERSION >= 0x360
+extern int count_hit_free_list_asyncgens[NUITKA_FREELIST_BINS];
+extern int count_miss_free_list_asyncgens[NUITKA_FREELIST_BINS];
+#endif
+#else
+#define _countFreeListBinHit(free_list, bin)
+#define _countFreeListBinMiss(free_list, bin)
+#endif
+
+#define NUITKA_DECLARE_BINNED_FREELIST(free_list, object_type)                                                         \
+    NUITKA_FREELIST_STORAGE object_type *free_list[NUITKA_FREELIST_BINS];                                              \
+    NUITKA_FREELIST_STORAGE int free_list##_count[NUITKA_FREELIST_BINS]
+
+#define allocateFromBinnedFreeList(free_list, object_type, type_type, size, min_size)                                  \
+    {                                                                                                                  \
+        int bin = Nuitka_GetFreeListBin(size, min_size);                                                               \
+                                                                                                                       \
+        if (free_list[bin] != NULL) {                                                                                  \
+            _countFreeListBinHit(free_list, bin);                                                                      \
+                                                                                                                       \
+            result = free_list[bin];                                                                                   \
+            free_list[bin] = *((object_type **)result);                                                                \
+            free_list##_count[bin] -= 1;                                                                               \
+            assert(free_list##_count[bin] >= 0);                                                                       \
+                                                                                                                       \
+            if (Py_SIZE(result) < size) {                                                                              \
+                assert(bin == NUITKA_FREELIST_BINS - 1);                                                               \
+                                                                                                                       \
+                result = PyObject_GC_Resize(object_type, result, size);                                                \
+                assert(result != NULL);                                                                                \
+            }                                                                                                          \
+                                                                                                                       \
+            Nuitka_Py_NewReference((PyObject *)result);                                                                \
+        } else {                                                                                                       \
+            _countFreeListBinMiss(free_list, bin);                                                                     \
+                                                                                                                       \
+            result = (object_type *)Nuitka_GC_NewVar(&type_type, Nuitka_GetFreeListBinSize(bin, size, min_size));      \
+        }                                                                                                              \
+    }                                                                                                                  \
+    CHECK_OBJECT(result);
+
+#define releaseToBinnedFreeList(free_list, object, max_free_list_count, min_size)                                      \
+    _registerFreeListsRelease();                                                                                       \
+    {                                                                                                                  \
+        int bin = Nuitka_GetFreeListBin(Py_SIZE(object), min_size);                                                   \
+                                                                                                                       \
+        if (use_freelists && free_list##_count[bin] < max_free_list_count) {                                           \
+            *((void **)object) = (void *)free_list[bin];                                                               \
+            free_list[bin] = object;                                                                                   \
+                                                                                                                       \
+            free_list##_count[bin] += 1;                                                                               \
+        } else {                                                                                                       \
+            PyObject_GC_Del(object);                                                                                   \
+        }                                                                                                              \
+    }
+
+#define releaseAllFromBinnedFreeList(free_list, object_type)                                                           \
+    for (int bin = 0; bin < NUITKA_FREELIST_BINS; bin++) {                                                             \
+        while (free_list[bin] != NULL) {                                                                               \
+            object_type *object = free_list[bin];                                                                      \
+            free_list[bin] = *((object_type **)free_list[bin]);                                                        \
+            PyObject_GC_Del(object);                                                                                   \
+        }                                                                                                              \
+        free_list##_count[bin] = 0;                                                                                    \
+    }
+
 #endif
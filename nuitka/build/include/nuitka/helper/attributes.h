@@ -21,6 +21,61 @@
 // Attribute lookup except special slots below.
 extern PyObject *LOOKUP_ATTRIBUTE(PyThreadState *tstate, PyObject *source, PyObject *attr_name);
 
+// Attribute lookup with a cache per call site, for types that use the generic
+// attribute lookup, keyed on the type version tag, which changes whenever the
+// type or one of its bases is modified. Not for Python 3.11 or higher, where
+// the generic lookup is not done by us.
+#if PYTHON_VERSION >= 0x300 && PYTHON_VERSION < 0x3b0
+#define NUITKA_ATTRIBUTE_CACHE_NONE 0
+#define NUITKA_ATTRIBUTE_CACHE_PLAIN 1
+#define NUITKA_ATTRIBUTE_CACHE_NON_DATA_DESCRIPTOR 2
+#define NUITKA_ATTRIBUTE_CACHE_DATA_DESCRIPTOR 3
+#define NUITKA_ATTRIBUTE_CACHE_SLOT 4
+
+struct Nuitka_AttributeCache {
+    // Zero means the cache is not filled.
+    unsigned int type_version_tag;
+
+    // What the type lookup found, one of the values above.
+    int kind;
+
+    // The type attribute found, not a reference, the type dictionary holds
+    // it for as long as the version tag is unchanged.
+    PyObject *descr;
+
+    // For slots, the offset of the value in the object.
+    Py_ssize_t slot_offset;
+};
+
+extern PyObject *LOOKUP_ATTRIBUTE_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                         struct Nuitka_AttributeCache *cache);
+
+// Fill the cache from a type lookup, if the type is suitable. Must be called
+// without an exception set.
+extern void Nuitka_FillAttributeCache(PyTypeObject *type, PyObject *attr_name, struct Nuitka_AttributeCache *cache);
+
+// The instance dictionary of an object, not a reference, may be NULL.
+NUITKA_MAY_BE_UNUSED static PyObject *Nuitka_GetInstanceDict(PyTypeObject *type, PyObject *source) {
+    Py_ssize_t dict_offset = type->tp_dictoffset;
+
+    if (dict_offset == 0) {
+        return NULL;
+    }
+
+    // Negative dictionary offsets have special meaning.
+    if (dict_offset < 0) {
+        Py_ssize_t tsize = ((PyVarObject *)source)->ob_size;
+        if (tsize < 0) {
+            tsize = -tsize;
+        }
+
+        dict_offset += (long)_PyObject_VAR_SIZE(type, tsize);
+    }
+
+    return *(PyObject **)((char *)source + dict_offset);
+}
+#endif
+
 // Attribute lookup of attribute slot "__dict__".
 extern PyObject *LOOKUP_ATTRIBUTE_DICT_SLOT(PyThreadState *tstate, PyObject *source);
 
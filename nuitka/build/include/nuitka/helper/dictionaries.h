@@ -283,6 +283,22 @@ extern int DICT_HAS_ITEM(PyThreadState *tstate, PyObject *dict, PyObject *key);
 // Convert to dictionary, helper for built-in "dict" mainly.
 extern PyObject *TO_DICT(PyThreadState *tstate, PyObject *seq_obj, PyObject *dict_obj);
 
+// Dictionaries carry a version tag, that changes with every modification,
+// which caches use to tell if something can have changed.
+#if PYTHON_VERSION >= 0x360 && PYTHON_VERSION < 0x3c0
+#define NUITKA_DICT_HAS_VERSION_TAG 1
+
+// Versions for dictionaries that we change without CPython knowing. These
+// have the top bit set, so they never clash with the ones CPython gives.
+extern uint64_t Nuitka_dict_version_counter;
+
+NUITKA_MAY_BE_UNUSED static void UPDATE_DICT_VERSION_TAG(PyDictObject *dict) {
+    dict->ma_version_tag = ++Nuitka_dict_version_counter;
+}
+#else
+#define NUITKA_DICT_HAS_VERSION_TAG 0
+#endif
+
 NUITKA_MAY_BE_UNUSED static void UPDATE_STRING_DICT0(PyDictObject *dict, Nuitka_StringObject *key, PyObject *value) {
     CHECK_OBJECT(value);
 
@@ -302,6 +318,9 @@ NUITKA_MAY_BE_UNUSED static void UPDATE_STRING_DICT0(PyDictObject *dict, Nuitka_
     if (likely(old != NULL)) {
         Py_INCREF(value);
         SET_DICT_ENTRY_VALUE(entry, value);
+#if NUITKA_DICT_HAS_VERSION_TAG
+        UPDATE_DICT_VERSION_TAG(dict);
+#endif
 
         CHECK_OBJECT(old);
 
@@ -334,6 +353,9 @@ NUITKA_MAY_BE_UNUSED static void UPDATE_STRING_DICT_INPLACE(PyDictObject *dict,
     // speculatively try the quickest access method.
     if (likely(old != NULL)) {
         SET_DICT_ENTRY_VALUE(entry, value);
+#if NUITKA_DICT_HAS_VERSION_TAG
+        UPDATE_DICT_VERSION_TAG(dict);
+#endif
     } else {
         DICT_SET_ITEM((PyObject *)dict, (PyObject *)key, value);
         Py_DECREF(value);
@@ -364,6 +386,9 @@ NUITKA_MAY_BE_UNUSED static void UPDATE_STRING_DICT1(PyDictObject *dict, Nuitka_
     // speculatively try the quickest access method.
     if (likely(old != NULL)) {
         SET_DICT_ENTRY_VALUE(entry, value);
+#if NUITKA_DICT_HAS_VERSION_TAG
+        UPDATE_DICT_VERSION_TAG(dict);
+#endif
 
         Py_DECREF(old);
     } else {
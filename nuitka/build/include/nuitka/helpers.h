@@ -93,6 +93,16 @@ extern void startProfiling(void);
 extern void stopProfiling(void);
 #endif
 
+// The built-in sampling profiler, enabled by environment variable at run time,
+// needs signals and the thread state layout we know.
+#if !defined(_WIN32) && defined(_NUITKA_EXE) && PYTHON_VERSION >= 0x370 && PYTHON_VERSION < 0x3c0
+#define _NUITKA_SAMPLING_PROFILER 1
+extern void startSamplingProfiler(void);
+extern void stopSamplingProfiler(void);
+#else
+#define _NUITKA_SAMPLING_PROFILER 0
+#endif
+
 #include "nuitka/helper/boolean.h"
 #include "nuitka/helper/dictionaries.h"
 #include "nuitka/helper/indexes.h"
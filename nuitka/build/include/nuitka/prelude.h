@@ -203,6 +203,15 @@ extern _PyRuntimeState _PyRuntime;
 #define NUITKA_MAY_BE_UNUSED
 #endif
 
+/* A way to indicate that a function is rarely used, e.g. was never called in
+ * a PGO run, so the C compiler can optimize it for size and place it apart.
+ */
+#ifdef __GNUC__
+#define NUITKA_COLD __attribute__((__cold__))
+#else
+#define NUITKA_COLD
+#endif
+
 /* This is used to indicate code control flows we know cannot happen. */
 #ifndef __NUITKA_NO_ASSERT__
 #define NUITKA_CANNOT_GET_HERE(NAME)                                                                                   \
@@ -41,6 +41,19 @@ extern void PGO_onProbePassed(char const *module_name, char const *probe_id, uin
 
 extern void PGO_onTechnicalModule(char const *module_name);
 
+// Intern a probe name, giving its ID, which is never 0.
+extern uint32_t PGO_getStringID(char const *str);
+
+// Probe sites keep the ID of their name in a static variable, initially 0, so
+// that the name is interned only once.
+#define PGO_PROBE_ID(probe_id, probe_name)                                                                             \
+    (likely((probe_id) != 0) ? (probe_id) : ((probe_id) = PGO_getStringID(probe_name)))
+
+// When a function is called, counted per name.
+extern void PGO_onFunctionEntered(uint32_t probe_id);
+// When a branch is decided, counted per name and outcome.
+extern void PGO_onBranchPassed(uint32_t probe_id, bool taken);
+
 #else
 
 #define PGO_Initialize()
@@ -51,6 +64,9 @@ extern void PGO_onTechnicalModule(char const *module_name);
 
 #define PGO_onProbePassed(module_name, probe_id, probe_arg) ;
 
+#define PGO_onFunctionEntered(probe_id) ;
+#define PGO_onBranchPassed(probe_id, taken) ;
+
 #endif
 
 #endif
\ No newline at end of file
@@ -969,9 +969,15 @@ static void Nuitka_Asyncgen_tp_finalize(struct Nuitka_AsyncgenObject *asyncgen)
     RESTORE_ERROR_OCCURRED(tstate, save_exception_type, save_exception_value, save_exception_tb);
 }
 
+#ifndef MAX_ASYNCGEN_FREE_LIST_COUNT
 #define MAX_ASYNCGEN_FREE_LIST_COUNT 100
-static struct Nuitka_AsyncgenObject *free_list_asyncgens = NULL;
-static int free_list_asyncgens_count = 0;
+#endif
+NUITKA_DECLARE_BINNED_FREELIST(free_list_asyncgens, struct Nuitka_AsyncgenObject);
+
+#if _DEBUG_REFCOUNTS
+int count_hit_free_list_asyncgens[NUITKA_FREELIST_BINS];
+int count_miss_free_list_asyncgens[NUITKA_FREELIST_BINS];
+#endif
 
 // TODO: This might have to be finalize actually.
 static void Nuitka_Asyncgen_tp_dealloc(struct Nuitka_AsyncgenObject *asyncgen) {
@@ -1044,7 +1050,8 @@ static void Nuitka_Asyncgen_tp_dealloc(struct Nuitka_AsyncgenObject *asyncgen) {
     Py_DECREF(asyncgen->m_qualname);
 
     /* Put the object into free list or release to GC */
-    releaseToFreeList(free_list_asyncgens, asyncgen, MAX_ASYNCGEN_FREE_LIST_COUNT);
+    releaseToBinnedFreeList(free_list_asyncgens, asyncgen, MAX_ASYNCGEN_FREE_LIST_COUNT,
+                            NUITKA_GENERATOR_FREE_LIST_MIN_SIZE);
 
     RESTORE_ERROR_OCCURRED(tstate, save_exception_type, save_exception_value, save_exception_tb);
 }
@@ -1172,7 +1179,8 @@ PyObject *Nuitka_Asyncgen_New(asyncgen_code code, PyObject *module, PyObject *na
     Py_ssize_t full_size = closure_given + (heap_storage_size + sizeof(void *) - 1) / sizeof(void *);
 
     // Macro to assign result memory from GC or free list.
-    allocateFromFreeList(free_list_asyncgens, struct Nuitka_AsyncgenObject, Nuitka_Asyncgen_Type, full_size);
+    allocateFromBinnedFreeList(free_list_asyncgens, struct Nuitka_AsyncgenObject, Nuitka_Asyncgen_Type, full_size,
+                               NUITKA_GENERATOR_FREE_LIST_MIN_SIZE);
 
     // For quicker access of generator heap.
     result->m_heap_storage = &result->m_closure[closure_given];
@@ -1238,8 +1246,7 @@ struct Nuitka_AsyncgenWrappedValueObject {
         PyObject *m_value;
 };
 
-static struct Nuitka_AsyncgenWrappedValueObject *free_list_asyncgen_value_wrappers = NULL;
-static int free_list_asyncgen_value_wrappers_count = 0;
+NUITKA_DECLARE_FREELIST(free_list_asyncgen_value_wrappers, struct Nuitka_AsyncgenWrappedValueObject);
 
 static void Nuitka_AsyncgenValueWrapper_tp_dealloc(struct Nuitka_AsyncgenWrappedValueObject *asyncgen_value_wrapper) {
 #if _DEBUG_REFCOUNTS
@@ -1442,8 +1449,7 @@ static PyObject *_Nuitka_Asyncgen_unwrap_value(PyThreadState *tstate, struct Nui
     return result;
 }
 
-static struct Nuitka_AsyncgenAsendObject *free_list_asyncgen_asends = NULL;
-static int free_list_asyncgen_asends_count = 0;
+NUITKA_DECLARE_FREELIST(free_list_asyncgen_asends, struct Nuitka_AsyncgenAsendObject);
 
 static void Nuitka_AsyncgenAsend_tp_dealloc(struct Nuitka_AsyncgenAsendObject *asyncgen_asend) {
 #if _DEBUG_REFCOUNTS
@@ -1815,8 +1821,7 @@ NUITKA_MAY_BE_UNUSED static void _PRINT_ASYNCGENATHROW_STATUS(char const *descri
 
 #endif
 
-static struct Nuitka_AsyncgenAthrowObject *free_list_asyncgen_athrows = NULL;
-static int free_list_asyncgen_athrows_count = 0;
+NUITKA_DECLARE_FREELIST(free_list_asyncgen_athrows, struct Nuitka_AsyncgenAthrowObject);
 
 static void Nuitka_AsyncgenAthrow_dealloc(struct Nuitka_AsyncgenAthrowObject *asyncgen_athrow) {
 #if _DEBUG_REFCOUNTS
@@ -31,9 +31,10 @@
 #include "nuitka/prelude.h"
 #endif
 
+#ifndef MAX_CELL_FREE_LIST_COUNT
 #define MAX_CELL_FREE_LIST_COUNT 1000
-static struct Nuitka_CellObject *free_list_cells = NULL;
-static int free_list_cells_count = 0;
+#endif
+NUITKA_DECLARE_FREELIST(free_list_cells, struct Nuitka_CellObject);
 
 static void Nuitka_Cell_tp_dealloc(struct Nuitka_CellObject *cell) {
     Nuitka_GC_UnTrack(cell);
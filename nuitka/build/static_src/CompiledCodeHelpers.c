@@ -56,7 +56,6 @@ static void _initBuiltinTypeMethods(void) {
 #include "HelpersExceptions.c"
 #include "HelpersFiles.c"
 #include "HelpersFloats.c"
-#include "HelpersHeapStorage.c"
 #include "HelpersImport.c"
 #include "HelpersImportHard.c"
 #include "HelpersLists.c"
@@ -2090,7 +2089,7 @@ PyObject *MAKE_UNION_TYPE(PyObject *args) {
 #include "HelpersChecksumTools.c"
 #include "HelpersConstantsBlob.c"
 
-#if _NUITKA_PROFILE
+#if _NUITKA_PROFILE || _NUITKA_SAMPLING_PROFILER
 #include "HelpersProfiling.c"
 #endif
 
@@ -1042,8 +1042,7 @@ static long Nuitka_Coroutine_tp_traverse(struct Nuitka_CoroutineObject *coroutin
     return 0;
 }
 
-static struct Nuitka_CoroutineWrapperObject *free_list_coro_wrappers = NULL;
-static int free_list_coro_wrappers_count = 0;
+NUITKA_DECLARE_FREELIST(free_list_coro_wrappers, struct Nuitka_CoroutineWrapperObject);
 
 static PyObject *Nuitka_Coroutine_await(struct Nuitka_CoroutineObject *coroutine) {
     CHECK_OBJECT(coroutine);
@@ -1117,9 +1116,15 @@ static void Nuitka_Coroutine_tp_finalize(struct Nuitka_CoroutineObject *coroutin
     RESTORE_ERROR_OCCURRED(tstate, save_exception_type, save_exception_value, save_exception_tb);
 }
 
+#ifndef MAX_COROUTINE_FREE_LIST_COUNT
 #define MAX_COROUTINE_FREE_LIST_COUNT 100
-static struct Nuitka_CoroutineObject *free_list_coros = NULL;
-static int free_list_coros_count = 0;
+#endif
+NUITKA_DECLARE_BINNED_FREELIST(free_list_coros, struct Nuitka_CoroutineObject);
+
+#if _DEBUG_REFCOUNTS
+int count_hit_free_list_coros[NUITKA_FREELIST_BINS];
+int count_miss_free_list_coros[NUITKA_FREELIST_BINS];
+#endif
 
 static void Nuitka_Coroutine_tp_dealloc(struct Nuitka_CoroutineObject *coroutine) {
 #if _DEBUG_REFCOUNTS
@@ -1180,7 +1185,8 @@ static void Nuitka_Coroutine_tp_dealloc(struct Nuitka_CoroutineObject *coroutine
 #endif
 
     /* Put the object into free list or release to GC */
-    releaseToFreeList(free_list_coros, coroutine, MAX_COROUTINE_FREE_LIST_COUNT);
+    releaseToBinnedFreeList(free_list_coros, coroutine, MAX_COROUTINE_FREE_LIST_COUNT,
+                            NUITKA_GENERATOR_FREE_LIST_MIN_SIZE);
 
     RESTORE_ERROR_OCCURRED(tstate, save_exception_type, save_exception_value, save_exception_tb);
 }
@@ -1466,7 +1472,8 @@ PyObject *Nuitka_Coroutine_New(PyThreadState *tstate, coroutine_code code, PyObj
     Py_ssize_t full_size = closure_given + (heap_storage_size + sizeof(void *) - 1) / sizeof(void *);
 
     // Macro to assign result memory from GC or free list.
-    allocateFromFreeList(free_list_coros, struct Nuitka_CoroutineObject, Nuitka_Coroutine_Type, full_size);
+    allocateFromBinnedFreeList(free_list_coros, struct Nuitka_CoroutineObject, Nuitka_Coroutine_Type, full_size,
+                               NUITKA_GENERATOR_FREE_LIST_MIN_SIZE);
 
     // For quicker access of generator heap.
     result->m_heap_storage = &result->m_closure[closure_given];
@@ -1709,8 +1716,7 @@ static int Nuitka_AIterWrapper_traverse(struct Nuitka_AIterWrapper *aw, visitpro
     return 0;
 }
 
-static struct Nuitka_AIterWrapper *free_list_coroutine_aiter_wrappers = NULL;
-static int free_list_coroutine_aiter_wrappers_count = 0;
+NUITKA_DECLARE_FREELIST(free_list_coroutine_aiter_wrappers, struct Nuitka_AIterWrapper);
 
 static void Nuitka_AIterWrapper_dealloc(struct Nuitka_AIterWrapper *aw) {
 #if _DEBUG_REFCOUNTS
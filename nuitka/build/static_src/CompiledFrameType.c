@@ -34,6 +34,9 @@ int count_active_frame_cache_instances = 0;
 int count_allocated_frame_cache_instances = 0;
 int count_released_frame_cache_instances = 0;
 int count_hit_frame_cache_instances = 0;
+
+int count_hit_free_list_frames[NUITKA_FREELIST_BINS];
+int count_miss_free_list_frames[NUITKA_FREELIST_BINS];
 #endif
 
 #if PYTHON_VERSION < 0x3b0
@@ -206,6 +209,28 @@ static PyObject *Nuitka_Frame_getlocals(struct Nuitka_FrameObject *nuitka_frame,
                 }
                 break;
             }
+            case NUITKA_TYPE_DESCRIPTION_DOUBLE: {
+                double value;
+                memcpy(&value, t, sizeof(double));
+                t += sizeof(double);
+
+                PyObject *float_value = MAKE_FLOAT_FROM_DOUBLE(value);
+                DICT_SET_ITEM(result, *var_names, float_value);
+                Py_DECREF(float_value);
+
+                break;
+            }
+            case NUITKA_TYPE_DESCRIPTION_LONG: {
+                long value;
+                memcpy(&value, t, sizeof(long));
+                t += sizeof(long);
+
+                PyObject *long_value = PyLong_FromLong(value);
+                DICT_SET_ITEM(result, *var_names, long_value);
+                Py_DECREF(long_value);
+
+                break;
+            }
             default:
                 assert(false);
             }
@@ -342,6 +367,16 @@ static void Nuitka_Frame_tp_clear(struct Nuitka_FrameObject *frame) {
 
                 break;
             }
+            case NUITKA_TYPE_DESCRIPTION_DOUBLE: {
+                t += sizeof(double);
+
+                break;
+            }
+            case NUITKA_TYPE_DESCRIPTION_LONG: {
+                t += sizeof(long);
+
+                break;
+            }
             default:
                 assert(false);
             }
@@ -353,9 +388,13 @@ static void Nuitka_Frame_tp_clear(struct Nuitka_FrameObject *frame) {
     }
 }
 
+// The free list of frames is split into bins by the size of the locals storage
+// in bytes, the limit applies per bin.
+#ifndef MAX_FRAME_FREE_LIST_COUNT
 #define MAX_FRAME_FREE_LIST_COUNT 100
-static struct Nuitka_FrameObject *free_list_frames = NULL;
-static int free_list_frames_count = 0;
+#endif
+#define NUITKA_FRAME_FREE_LIST_MIN_SIZE 64
+NUITKA_DECLARE_BINNED_FREELIST(free_list_frames, struct Nuitka_FrameObject);
 
 static void Nuitka_Frame_tp_dealloc(struct Nuitka_FrameObject *nuitka_frame) {
 #if _DEBUG_REFCOUNTS
@@ -401,7 +440,8 @@ static void Nuitka_Frame_tp_dealloc(struct Nuitka_FrameObject *nuitka_frame) {
     Py_SET_SIZE(nuitka_frame, nuitka_frame->m_ob_size);
 #endif
 
-    releaseToFreeList(free_list_frames, nuitka_frame, MAX_FRAME_FREE_LIST_COUNT);
+    releaseToBinnedFreeList(free_list_frames, nuitka_frame, MAX_FRAME_FREE_LIST_COUNT,
+                            NUITKA_FRAME_FREE_LIST_MIN_SIZE);
 
 #ifndef __NUITKA_NO_ASSERT__
     assert(tstate->curexc_type == save_exception_type);
@@ -464,6 +504,16 @@ static int Nuitka_Frame_tp_traverse(struct Nuitka_FrameObject *frame, visitproc
 
             break;
         }
+        case NUITKA_TYPE_DESCRIPTION_DOUBLE: {
+            t += sizeof(double);
+
+            break;
+        }
+        case NUITKA_TYPE_DESCRIPTION_LONG: {
+            t += sizeof(long);
+
+            break;
+        }
         default:
             assert(false);
         }
@@ -662,7 +712,8 @@ static struct Nuitka_FrameObject *_MAKE_COMPILED_FRAME(PyCodeObject *code, PyObj
     struct Nuitka_FrameObject *result;
 
     // Macro to assign result memory from GC or free list.
-    allocateFromFreeList(free_list_frames, struct Nuitka_FrameObject, Nuitka_Frame_Type, locals_size);
+    allocateFromBinnedFreeList(free_list_frames, struct Nuitka_FrameObject, Nuitka_Frame_Type, locals_size,
+                               NUITKA_FRAME_FREE_LIST_MIN_SIZE);
 
     result->m_type_description = NULL;
 
@@ -958,6 +1009,22 @@ void Nuitka_Frame_AttachLocals(struct Nuitka_FrameObject *frame_object, char con
 
             break;
         }
+        case NUITKA_TYPE_DESCRIPTION_DOUBLE: {
+            double value = va_arg(ap, double);
+            memcpy(t, &value, sizeof(double));
+
+            t += sizeof(value);
+
+            break;
+        }
+        case NUITKA_TYPE_DESCRIPTION_LONG: {
+            long value = va_arg(ap, long);
+            memcpy(t, &value, sizeof(long));
+
+            t += sizeof(value);
+
+            break;
+        }
         default:
             assert(false);
         }
@@ -644,9 +644,10 @@ static PyObject *Nuitka_Function_clone(struct Nuitka_FunctionObject *function) {
     return (PyObject *)result;
 }
 
+#ifndef MAX_FUNCTION_FREE_LIST_COUNT
 #define MAX_FUNCTION_FREE_LIST_COUNT 100
-static struct Nuitka_FunctionObject *free_list_functions = NULL;
-static int free_list_functions_count = 0;
+#endif
+NUITKA_DECLARE_FREELIST(free_list_functions, struct Nuitka_FunctionObject);
 
 static void Nuitka_Function_tp_dealloc(struct Nuitka_FunctionObject *function) {
     assert(Nuitka_Function_Check((PyObject *)function));
@@ -1585,7 +1586,8 @@ static Py_ssize_t handleKeywordArgsSplit(struct Nuitka_FunctionObject const *fun
                                          PyObject *const *kw_values, PyObject *kw_names)
 #else
 static Py_ssize_t handleKeywordArgsSplit(struct Nuitka_FunctionObject const *function, PyObject **python_pars,
-                                         Py_ssize_t *kw_only_found, PyObject *const *kw_values, PyObject *kw_names)
+                                         Py_ssize_t *kw_only_found, PyObject *const *kw_values, PyObject *kw_names,
+                                         Py_ssize_t *kw_indexes)
 #endif
 {
     Py_ssize_t keywords_count = function->m_args_keywords_count;
@@ -1625,6 +1627,10 @@ static Py_ssize_t handleKeywordArgsSplit(struct Nuitka_FunctionObject const *fun
                 if (i >= keyword_after_index) {
                     *kw_only_found += 1;
                 }
+
+                if (kw_indexes != NULL) {
+                    kw_indexes[kw_index] = i;
+                }
 #endif
 
                 found = true;
@@ -1645,6 +1651,10 @@ static Py_ssize_t handleKeywordArgsSplit(struct Nuitka_FunctionObject const *fun
                     if (i >= keyword_after_index) {
                         *kw_only_found += 1;
                     }
+
+                    if (kw_indexes != NULL) {
+                        kw_indexes[kw_index] = i;
+                    }
 #endif
 
                     found = true;
@@ -2303,9 +2313,16 @@ static bool parseArgumentsMethodPos(PyThreadState *tstate, struct Nuitka_Functio
     return true;
 }
 
+#if PYTHON_VERSION >= 0x300
+static bool parseArgumentsFullKwSplit(PyThreadState *tstate, struct Nuitka_FunctionObject const *function,
+                                      PyObject **python_pars, PyObject *const *args, Py_ssize_t args_size,
+                                      PyObject *const *kw_values, PyObject *kw_names,
+                                      struct Nuitka_KeywordArgsCache *cache) {
+#else
 static bool parseArgumentsFullKwSplit(PyThreadState *tstate, struct Nuitka_FunctionObject const *function,
                                       PyObject **python_pars, PyObject *const *args, Py_ssize_t args_size,
                                       PyObject *const *kw_values, PyObject *kw_names) {
+#endif
     Py_ssize_t kw_size = PyTuple_GET_SIZE(kw_names);
     Py_ssize_t kw_found;
     bool result;
@@ -2337,11 +2354,50 @@ static bool parseArgumentsFullKwSplit(PyThreadState *tstate, struct Nuitka_Funct
             releaseParameters(function, python_pars);
             return false;
         }
-    } else {
+    }
+#if PYTHON_VERSION >= 0x300
+    else if (cache != NULL && cache->code_object == function->m_code_object) {
+        // The call site passed the same names to this code before, no need
+        // to match them again.
+        assert(kw_size <= NUITKA_KEYWORD_ARGS_CACHE_SIZE);
+
+        for (Py_ssize_t kw_index = 0; kw_index < kw_size; kw_index++) {
+            Py_ssize_t i = cache->kw_indexes[kw_index];
+
+            assert(python_pars[i] == NULL);
+            python_pars[i] = kw_values[kw_index];
+            Py_INCREF(python_pars[i]);
+        }
+
+        kw_found = kw_size;
+        kw_only_found = cache->kw_only_found;
+    }
+#endif
+    else {
 #if PYTHON_VERSION < 0x300
         kw_found = handleKeywordArgsSplit(function, python_pars, kw_values, kw_names);
 #else
-        kw_found = handleKeywordArgsSplit(function, python_pars, &kw_only_found, kw_values, kw_names);
+        // Invalidate first, the indexes are written as they are found. The
+        // reference is only released when done, that may run code.
+        PyCodeObject *old_code_object = NULL;
+
+        if (cache != NULL) {
+            assert(kw_size <= NUITKA_KEYWORD_ARGS_CACHE_SIZE);
+
+            old_code_object = cache->code_object;
+            cache->code_object = NULL;
+        }
+
+        kw_found = handleKeywordArgsSplit(function, python_pars, &kw_only_found, kw_values, kw_names,
+                                          cache != NULL ? cache->kw_indexes : NULL);
+
+        if (cache != NULL && kw_found != -1) {
+            Py_INCREF(function->m_code_object);
+            cache->code_object = function->m_code_object;
+            cache->kw_only_found = kw_only_found;
+        }
+
+        Py_XDECREF(old_code_object);
 #endif
         if (unlikely(kw_found == -1)) {
             releaseParameters(function, python_pars);
@@ -2524,12 +2580,36 @@ PyObject *Nuitka_CallFunctionPosArgsKwSplit(PyThreadState *tstate, struct Nuitka
     NUITKA_DYNAMIC_ARRAY_DECL(python_pars, PyObject *, function->m_args_overall_count);
     memset(python_pars, 0, function->m_args_overall_count * sizeof(PyObject *));
 
+#if PYTHON_VERSION >= 0x300
+    if (unlikely(
+            !parseArgumentsFullKwSplit(tstate, function, python_pars, args, args_size, kw_values, kw_names, NULL))) {
+        return NULL;
+    }
+#else
     if (unlikely(!parseArgumentsFullKwSplit(tstate, function, python_pars, args, args_size, kw_values, kw_names))) {
         return NULL;
     }
+#endif
+
+    return function->m_c_code(tstate, function, python_pars);
+}
+
+#if PYTHON_VERSION >= 0x300
+PyObject *Nuitka_CallFunctionPosArgsKwSplitCached(PyThreadState *tstate, struct Nuitka_FunctionObject const *function,
+                                                  PyObject *const *args, Py_ssize_t args_size,
+                                                  PyObject *const *kw_values, PyObject *kw_names,
+                                                  struct Nuitka_KeywordArgsCache *cache) {
+    NUITKA_DYNAMIC_ARRAY_DECL(python_pars, PyObject *, function->m_args_overall_count);
+    memset(python_pars, 0, function->m_args_overall_count * sizeof(PyObject *));
+
+    if (unlikely(
+            !parseArgumentsFullKwSplit(tstate, function, python_pars, args, args_size, kw_values, kw_names, cache))) {
+        return NULL;
+    }
 
     return function->m_c_code(tstate, function, python_pars);
 }
+#endif
 
 PyObject *Nuitka_CallMethodFunctionNoArgs(PyThreadState *tstate, struct Nuitka_FunctionObject const *function,
                                           PyObject *object) {
@@ -2914,4 +2994,70 @@ static PyObject *Nuitka_Function_tp_vectorcall(struct Nuitka_FunctionObject *fun
 
 #include "CompiledCodeHelpers.c"
 
-#include "InspectPatcher.c"
\ No newline at end of file
+#include "InspectPatcher.c"
+
+#if NUITKA_THREAD_LOCAL_FREELISTS
+// Release the thread local free lists of a thread that exits, otherwise the
+// objects cached in them would be lost.
+static void Nuitka_ReleaseThreadFreeLists(void *unused) {
+    releaseAllFromFreeList(free_list_functions, struct Nuitka_FunctionObject);
+    releaseAllFromFreeList(free_list_methods, struct Nuitka_MethodObject);
+    releaseAllFromBinnedFreeList(free_list_generators, struct Nuitka_GeneratorObject);
+#if PYTHON_VERSION >= 0x350
+    releaseAllFromBinnedFreeList(free_list_coros, struct Nuitka_CoroutineObject);
+    releaseAllFromFreeList(free_list_coro_wrappers, struct Nuitka_CoroutineWrapperObject);
+    releaseAllFromFreeList(free_list_coroutine_aiter_wrappers, struct Nuitka_AIterWrapper);
+#endif
+#if PYTHON_VERSION >= 0x360
+    releaseAllFromBinnedFreeList(free_list_asyncgens, struct Nuitka_AsyncgenObject);
+    releaseAllFromFreeList(free_list_asyncgen_value_wrappers, struct Nuitka_AsyncgenWrappedValueObject);
+    releaseAllFromFreeList(free_list_asyncgen_asends, struct Nuitka_AsyncgenAsendObject);
+    releaseAllFromFreeList(free_list_asyncgen_athrows, struct Nuitka_AsyncgenAthrowObject);
+#endif
+    releaseAllFromBinnedFreeList(free_list_frames, struct Nuitka_FrameObject);
+    releaseAllFromFreeList(free_list_cells, struct Nuitka_CellObject);
+    releaseAllFromFreeList(free_list_loaders, struct Nuitka_LoaderObject);
+    releaseAllFromFreeList(free_list_tracebacks, PyTracebackObject);
+
+    Nuitka_free_lists_release_registered = false;
+}
+
+NUITKA_FREELIST_THREAD_LOCAL bool Nuitka_free_lists_release_registered = false;
+
+#if defined(_WIN32)
+static DWORD free_lists_release_key = FLS_OUT_OF_INDEXES;
+
+static void NTAPI _releaseThreadFreeLists(void *value) { Nuitka_ReleaseThreadFreeLists(value); }
+
+void Nuitka_RegisterThreadFreeListsRelease(void) {
+    // The first release happens in the main thread, before other threads exist.
+    if (free_lists_release_key == FLS_OUT_OF_INDEXES) {
+        free_lists_release_key = FlsAlloc(_releaseThreadFreeLists);
+    }
+
+    if (free_lists_release_key != FLS_OUT_OF_INDEXES) {
+        FlsSetValue(free_lists_release_key, (void *)1);
+    }
+
+    Nuitka_free_lists_release_registered = true;
+}
+#else
+#include <pthread.h>
+
+static pthread_key_t free_lists_release_key;
+static pthread_once_t free_lists_release_once = PTHREAD_ONCE_INIT;
+
+static void _createFreeListsReleaseKey(void) {
+    pthread_key_create(&free_lists_release_key, Nuitka_ReleaseThreadFreeLists);
+}
+
+void Nuitka_RegisterThreadFreeListsRelease(void) {
+    pthread_once(&free_lists_release_once, _createFreeListsReleaseKey);
+
+    // Only values that are not NULL get their destructor called.
+    pthread_setspecific(free_lists_release_key, (void *)1);
+
+    Nuitka_free_lists_release_registered = true;
+}
+#endif
+#endif
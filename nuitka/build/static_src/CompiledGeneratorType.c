@@ -1271,9 +1271,18 @@ static void Nuitka_Generator_tp_finalizer(struct Nuitka_GeneratorObject *generat
 }
 #endif
 
+// The free lists of generators, coroutines, and asyncgens are split into bins
+// by the size of closure and heap storage in pointers, the limit applies per bin.
+#ifndef MAX_GENERATOR_FREE_LIST_COUNT
 #define MAX_GENERATOR_FREE_LIST_COUNT 100
-static struct Nuitka_GeneratorObject *free_list_generators = NULL;
-static int free_list_generators_count = 0;
+#endif
+#define NUITKA_GENERATOR_FREE_LIST_MIN_SIZE 8
+NUITKA_DECLARE_BINNED_FREELIST(free_list_generators, struct Nuitka_GeneratorObject);
+
+#if _DEBUG_REFCOUNTS
+int count_hit_free_list_generators[NUITKA_FREELIST_BINS];
+int count_miss_free_list_generators[NUITKA_FREELIST_BINS];
+#endif
 
 static void Nuitka_Generator_tp_dealloc(struct Nuitka_GeneratorObject *generator) {
     // Revive temporarily.
@@ -1327,7 +1336,8 @@ static void Nuitka_Generator_tp_dealloc(struct Nuitka_GeneratorObject *generator
 #endif
 
     /* Put the object into free list or release to GC */
-    releaseToFreeList(free_list_generators, generator, MAX_GENERATOR_FREE_LIST_COUNT);
+    releaseToBinnedFreeList(free_list_generators, generator, MAX_GENERATOR_FREE_LIST_COUNT,
+                            NUITKA_GENERATOR_FREE_LIST_MIN_SIZE);
 
     RESTORE_ERROR_OCCURRED(tstate, save_exception_type, save_exception_value, save_exception_tb);
 }
@@ -1618,7 +1628,8 @@ PyObject *Nuitka_Generator_New(generator_code code, PyObject *module, PyObject *
     Py_ssize_t full_size = closure_given + (heap_storage_size + sizeof(void *) - 1) / sizeof(void *);
 
     // Macro to assign result memory from GC or free list.
-    allocateFromFreeList(free_list_generators, struct Nuitka_GeneratorObject, Nuitka_Generator_Type, full_size);
+    allocateFromBinnedFreeList(free_list_generators, struct Nuitka_GeneratorObject, Nuitka_Generator_Type, full_size,
+                               NUITKA_GENERATOR_FREE_LIST_MIN_SIZE);
 
     // For quicker access of generator heap.
     result->m_heap_storage = &result->m_closure[closure_given];
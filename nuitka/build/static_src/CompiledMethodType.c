@@ -419,9 +419,10 @@ static long Nuitka_Method_tp_hash(struct Nuitka_MethodObject *method) {
     return method->m_function->m_counter;
 }
 
+#ifndef MAX_METHOD_FREE_LIST_COUNT
 #define MAX_METHOD_FREE_LIST_COUNT 100
-static struct Nuitka_MethodObject *free_list_methods = NULL;
-static int free_list_methods_count = 0;
+#endif
+NUITKA_DECLARE_FREELIST(free_list_methods, struct Nuitka_MethodObject);
 
 static void Nuitka_Method_tp_dealloc(struct Nuitka_MethodObject *method) {
 #ifndef __NUITKA_NO_ASSERT__
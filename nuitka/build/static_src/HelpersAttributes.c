@@ -22,6 +22,8 @@
 #include "nuitka/prelude.h"
 #endif
 
+#include "structmember.h"
+
 // spell-checker: ignore klass
 
 #if PYTHON_VERSION < 0x300
@@ -268,6 +270,141 @@ PyObject *LOOKUP_ATTRIBUTE(PyThreadState *tstate, PyObject *source, PyObject *at
 #endif
 }
 
+#if PYTHON_VERSION >= 0x300 && PYTHON_VERSION < 0x3b0
+void Nuitka_FillAttributeCache(PyTypeObject *type, PyObject *attr_name, struct Nuitka_AttributeCache *cache) {
+    cache->type_version_tag = 0;
+
+    if (!hasTypeGenericGetAttr(type) || type->tp_dict == NULL) {
+        return;
+    }
+
+    // This assigns a version tag if the type can have one. Nothing may run
+    // between this and taking the version tag.
+    PyObject *descr = Nuitka_TypeLookup(type, attr_name);
+
+    if (!PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG) || type->tp_version_tag == 0) {
+        return;
+    }
+
+    int kind;
+    Py_ssize_t slot_offset = 0;
+
+    if (descr == NULL) {
+        kind = NUITKA_ATTRIBUTE_CACHE_NONE;
+    } else if (Py_TYPE(descr)->tp_descr_get == NULL) {
+        kind = NUITKA_ATTRIBUTE_CACHE_PLAIN;
+    } else if (!PyDescr_IsData(descr)) {
+        kind = NUITKA_ATTRIBUTE_CACHE_NON_DATA_DESCRIPTOR;
+    } else if (Py_TYPE(descr) == &PyMemberDescr_Type &&
+               ((PyMemberDescrObject *)descr)->d_member->type == T_OBJECT_EX &&
+               (((PyMemberDescrObject *)descr)->d_member->flags & READ_RESTRICTED) == 0) {
+        // Object slots, e.g. from "__slots__", we can read directly.
+        kind = NUITKA_ATTRIBUTE_CACHE_SLOT;
+        slot_offset = ((PyMemberDescrObject *)descr)->d_member->offset;
+    } else {
+        kind = NUITKA_ATTRIBUTE_CACHE_DATA_DESCRIPTOR;
+    }
+
+    cache->kind = kind;
+    cache->descr = descr;
+    cache->slot_offset = slot_offset;
+    cache->type_version_tag = type->tp_version_tag;
+}
+
+PyObject *LOOKUP_ATTRIBUTE_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                  struct Nuitka_AttributeCache *cache) {
+    CHECK_OBJECT(source);
+    CHECK_OBJECT(attr_name);
+
+#if _NUITKA_EXPERIMENTAL_DISABLE_ATTR_OPT
+    return PyObject_GetAttr(source, attr_name);
+#else
+    PyTypeObject *type = Py_TYPE(source);
+
+    if (likely(cache->type_version_tag != 0 && type->tp_version_tag == cache->type_version_tag &&
+               PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))) {
+        PyObject *descr = cache->descr;
+
+        switch (cache->kind) {
+        case NUITKA_ATTRIBUTE_CACHE_SLOT: {
+            PyObject *result = *(PyObject **)((char *)source + cache->slot_offset);
+
+            if (likely(result != NULL)) {
+                Py_INCREF(result);
+                return result;
+            }
+
+            // Let the generic code raise the error.
+            break;
+        }
+        case NUITKA_ATTRIBUTE_CACHE_DATA_DESCRIPTOR: {
+            // The call may modify the type, and release the descriptor.
+            Py_INCREF(descr);
+            PyObject *result = Py_TYPE(descr)->tp_descr_get(descr, source, (PyObject *)type);
+            Py_DECREF(descr);
+
+            CHECK_OBJECT_X(result);
+            return result;
+        }
+        default: {
+            PyObject *dict = Nuitka_GetInstanceDict(type, source);
+
+            if (dict != NULL) {
+                CHECK_OBJECT(dict);
+
+                // The dictionary lookup may run code, that releases any of these.
+                Py_INCREF(dict);
+                Py_XINCREF(descr);
+
+                PyObject *result = DICT_GET_ITEM1(tstate, dict, attr_name);
+
+                Py_DECREF(dict);
+
+                if (result != NULL) {
+                    Py_XDECREF(descr);
+
+                    CHECK_OBJECT(result);
+                    return result;
+                }
+
+                if (descr != NULL && (cache->type_version_tag != type->tp_version_tag ||
+                                      !PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))) {
+                    Py_DECREF(descr);
+                    break;
+                }
+
+                Py_XDECREF(descr);
+            }
+
+            if (cache->kind == NUITKA_ATTRIBUTE_CACHE_NON_DATA_DESCRIPTOR) {
+                Py_INCREF(descr);
+                PyObject *result = Py_TYPE(descr)->tp_descr_get(descr, source, (PyObject *)type);
+                Py_DECREF(descr);
+
+                CHECK_OBJECT_X(result);
+                return result;
+            } else if (cache->kind == NUITKA_ATTRIBUTE_CACHE_PLAIN) {
+                Py_INCREF(descr);
+                return descr;
+            }
+
+            // Let the generic code raise the error.
+            break;
+        }
+        }
+    }
+
+    PyObject *result = LOOKUP_ATTRIBUTE(tstate, source, attr_name);
+
+    if (result != NULL) {
+        Nuitka_FillAttributeCache(type, attr_name, cache);
+    }
+
+    return result;
+#endif
+}
+#endif
+
 PyObject *LOOKUP_ATTRIBUTE_DICT_SLOT(PyThreadState *tstate, PyObject *source) {
     CHECK_OBJECT(source);
 
@@ -258,6 +258,225 @@ PyObject *CALL_METHOD_WITH_POSARGS(PyThreadState *tstate, PyObject *source, PyOb
     }
 }
 
+#if PYTHON_VERSION >= 0x300 && PYTHON_VERSION < 0x3b0
+
+#if _DEBUG_REFCOUNTS
+int count_hit_method_call_cache = 0;
+int count_miss_method_call_cache = 0;
+int count_invalidated_method_call_cache = 0;
+int count_uncacheable_method_call_cache = 0;
+#endif
+
+static PyObject *_CALL_METHOD_WITH_ARGS_UNCACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                                 PyObject *const *args, Py_ssize_t args_count) {
+    switch (args_count) {
+    case 0:
+        return CALL_METHOD_NO_ARGS(tstate, source, attr_name);
+    case 1:
+        return CALL_METHOD_WITH_SINGLE_ARG(tstate, source, attr_name, args[0]);
+    case 2:
+        return CALL_METHOD_WITH_ARGS2(tstate, source, attr_name, args);
+    case 3:
+        return CALL_METHOD_WITH_ARGS3(tstate, source, attr_name, args);
+    case 4:
+        return CALL_METHOD_WITH_ARGS4(tstate, source, attr_name, args);
+    case 5:
+        return CALL_METHOD_WITH_ARGS5(tstate, source, attr_name, args);
+    case 6:
+        return CALL_METHOD_WITH_ARGS6(tstate, source, attr_name, args);
+    case 7:
+        return CALL_METHOD_WITH_ARGS7(tstate, source, attr_name, args);
+    case 8:
+        return CALL_METHOD_WITH_ARGS8(tstate, source, attr_name, args);
+    case 9:
+        return CALL_METHOD_WITH_ARGS9(tstate, source, attr_name, args);
+    case 10:
+        return CALL_METHOD_WITH_ARGS10(tstate, source, attr_name, args);
+    default:
+        NUITKA_CANNOT_GET_HERE("too many arguments for cached method call");
+        return NULL;
+    }
+}
+
+PyObject *CALL_METHOD_WITH_ARGS_CACHED(PyThreadState *tstate, PyObject *source, PyObject *attr_name,
+                                       PyObject *const *args, Py_ssize_t args_count,
+                                       struct Nuitka_AttributeCache *cache) {
+    CHECK_OBJECT(source);
+    CHECK_OBJECT(attr_name);
+    assert(args_count <= 10);
+
+    PyTypeObject *type = Py_TYPE(source);
+
+    // The cache also remembers what the type lookup found when that is not
+    // usable for us, so these call sites do not repeat the type lookup.
+    if (likely(cache->type_version_tag != 0 && type->tp_version_tag == cache->type_version_tag &&
+               PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))) {
+        // Only functions found in the type are used, and only if the instance
+        // dictionary does not shadow them, this is checked on every call.
+        if (likely(cache->kind == NUITKA_ATTRIBUTE_CACHE_NON_DATA_DESCRIPTOR)) {
+            PyObject *descr = cache->descr;
+            PyObject *dict = Nuitka_GetInstanceDict(type, source);
+
+            bool usable = true;
+
+            if (dict != NULL) {
+                CHECK_OBJECT(dict);
+
+                // The dictionary lookup may run code, that releases any of these.
+                Py_INCREF(dict);
+                Py_INCREF(descr);
+
+                PyObject *called_object = DICT_GET_ITEM1(tstate, dict, attr_name);
+
+                Py_DECREF(dict);
+                Py_DECREF(descr);
+
+                if (called_object != NULL) {
+                    Py_DECREF(called_object);
+                    usable = false;
+                } else {
+                    // The type may have been modified by the lookup, then the
+                    // next call refills the cache.
+                    usable = cache->type_version_tag == type->tp_version_tag &&
+                             PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG);
+                }
+            }
+
+            if (likely(usable)) {
+                if (Py_TYPE(descr) == &Nuitka_Function_Type) {
+#if _DEBUG_REFCOUNTS
+                    count_hit_method_call_cache += 1;
+#endif
+                    // The call may modify the type, and release the function.
+                    Py_INCREF(descr);
+
+                    PyObject *result;
+
+                    if (args_count == 0) {
+                        result = Nuitka_CallMethodFunctionNoArgs(tstate, (struct Nuitka_FunctionObject const *)descr,
+                                                                 source);
+                    } else {
+                        result = Nuitka_CallMethodFunctionPosArgs(tstate, (struct Nuitka_FunctionObject const *)descr,
+                                                                  source, args, args_count);
+                    }
+
+                    Py_DECREF(descr);
+
+                    return result;
+                }
+#if PYTHON_VERSION >= 0x380 && !defined(_NUITKA_EXPERIMENTAL_DISABLE_VECTORCALL_USAGE)
+                else if ((Py_TYPE(descr) == &PyFunction_Type || Py_TYPE(descr) == &PyMethodDescr_Type) &&
+                         PyType_HasFeature(Py_TYPE(descr), _Py_TPFLAGS_HAVE_VECTORCALL)) {
+                    vectorcallfunc func =
+                        *((vectorcallfunc *)(((char *)descr) + Py_TYPE(descr)->tp_vectorcall_offset));
+
+                    if (likely(func != NULL)) {
+#if _DEBUG_REFCOUNTS
+                        count_hit_method_call_cache += 1;
+#endif
+                        // Pass the object as the first argument, like the bound
+                        // method would do.
+                        PyObject *call_args[11];
+                        call_args[0] = source;
+
+                        if (args_count > 0) {
+                            memcpy(call_args + 1, args, sizeof(PyObject *) * args_count);
+                        }
+
+                        Py_INCREF(descr);
+                        PyObject *result = func(descr, call_args, args_count + 1, NULL);
+                        result = Nuitka_CheckFunctionResult(tstate, descr, result);
+                        Py_DECREF(descr);
+
+                        return result;
+                    }
+                }
+#endif
+            }
+        }
+
+        // Valid, but nothing we can call directly, the cache stays as it is.
+#if _DEBUG_REFCOUNTS
+        count_uncacheable_method_call_cache += 1;
+#endif
+        return _CALL_METHOD_WITH_ARGS_UNCACHED(tstate, source, attr_name, args, args_count);
+    }
+
+#if _DEBUG_REFCOUNTS
+    if (cache->type_version_tag != 0) {
+        count_invalidated_method_call_cache += 1;
+    } else {
+        count_miss_method_call_cache += 1;
+    }
+#endif
+
+    PyObject *result = _CALL_METHOD_WITH_ARGS_UNCACHED(tstate, source, attr_name, args, args_count);
+
+    if (result != NULL) {
+        Nuitka_FillAttributeCache(type, attr_name, cache);
+    }
+
+    return result;
+}
+#endif
+
+#if PYTHON_VERSION >= 0x300
+PyObject *CALL_FUNCTION_WITH_ARGS_KWSPLIT_CACHED(PyThreadState *tstate, PyObject *called, PyObject *const *args,
+                                                Py_ssize_t args_count, PyObject *const *kw_values, PyObject *kw_names,
+                                                struct Nuitka_KeywordArgsCache *cache) {
+    CHECK_OBJECT(called);
+    CHECK_OBJECTS(args, args_count);
+    CHECK_OBJECT(kw_names);
+    assert(PyTuple_CheckExact(kw_names));
+    assert(PyTuple_GET_SIZE(kw_names) <= NUITKA_KEYWORD_ARGS_CACHE_SIZE);
+    CHECK_OBJECTS(kw_values, PyTuple_GET_SIZE(kw_names));
+    assert(args_count <= 10);
+
+    if (Nuitka_Function_Check(called)) {
+        if (unlikely(Py_EnterRecursiveCall((char *)" while calling a Python object"))) {
+            return NULL;
+        }
+
+        PyObject *result = Nuitka_CallFunctionPosArgsKwSplitCached(
+            tstate, (struct Nuitka_FunctionObject const *)called, args, args_count, kw_values, kw_names, cache);
+
+        Py_LeaveRecursiveCall();
+
+        CHECK_OBJECT_X(result);
+
+        return result;
+    }
+
+    switch (args_count) {
+    case 0:
+        return CALL_FUNCTION_WITH_NO_ARGS_KWSPLIT(tstate, called, kw_values, kw_names);
+    case 1:
+        return CALL_FUNCTION_WITH_ARGS1_KWSPLIT(tstate, called, args, kw_values, kw_names);
+    case 2:
+        return CALL_FUNCTION_WITH_ARGS2_KWSPLIT(tstate, called, args, kw_values, kw_names);
+    case 3:
+        return CALL_FUNCTION_WITH_ARGS3_KWSPLIT(tstate, called, args, kw_values, kw_names);
+    case 4:
+        return CALL_FUNCTION_WITH_ARGS4_KWSPLIT(tstate, called, args, kw_values, kw_names);
+    case 5:
+        return CALL_FUNCTION_WITH_ARGS5_KWSPLIT(tstate, called, args, kw_values, kw_names);
+    case 6:
+        return CALL_FUNCTION_WITH_ARGS6_KWSPLIT(tstate, called, args, kw_values, kw_names);
+    case 7:
+        return CALL_FUNCTION_WITH_ARGS7_KWSPLIT(tstate, called, args, kw_values, kw_names);
+    case 8:
+        return CALL_FUNCTION_WITH_ARGS8_KWSPLIT(tstate, called, args, kw_values, kw_names);
+    case 9:
+        return CALL_FUNCTION_WITH_ARGS9_KWSPLIT(tstate, called, args, kw_values, kw_names);
+    case 10:
+        return CALL_FUNCTION_WITH_ARGS10_KWSPLIT(tstate, called, args, kw_values, kw_names);
+    default:
+        NUITKA_CANNOT_GET_HERE("too many arguments for cached keyword call");
+        return NULL;
+    }
+}
+#endif
+
 char const *GET_CALLABLE_NAME(PyObject *object) {
     if (Nuitka_Function_Check(object)) {
         return Nuitka_String_AsString(Nuitka_Function_GetName(object));
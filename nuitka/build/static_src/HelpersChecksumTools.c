@@ -44,9 +44,9 @@ uint32_t _updateCRC32(uint32_t crc, unsigned char const *message, uint32_t size)
 
 uint32_t _finalizeCRC32(uint32_t crc) { return ~crc; }
 
-// No Python runtime is available yet, need to do this in C.
-uint32_t calcCRC32(unsigned char const *message, uint32_t size) {
-    return _finalizeCRC32(_updateCRC32(_initCRC32(), message, size));
+// Continue a CRC32 value, the portable fallback for all hardware paths.
+static uint32_t _calcCRC32Generic(uint32_t crc, unsigned char const *message, uint32_t size) {
+    return _finalizeCRC32(_updateCRC32(~crc, message, size));
 }
 #else
 
@@ -56,5 +56,236 @@ uint32_t calcCRC32(unsigned char const *message, uint32_t size) {
 #include "crc32.c"
 #endif
 
-uint32_t calcCRC32(unsigned char const *message, uint32_t size) { return crc32(0, message, size) & 0xFFFFFFFF; }
-#endif
\ No newline at end of file
+// Continue a CRC32 value, the portable fallback for all hardware paths.
+static uint32_t _calcCRC32Generic(uint32_t crc, unsigned char const *message, uint32_t size) {
+    return crc32(crc, message, size) & 0xFFFFFFFF;
+}
+#endif
+
+// Hardware accelerated CRC32, selected at run time depending on the CPU. Note
+// that the SSE4.2 "crc32" instruction is of no use here, as it computes the
+// CRC32C with another polynomial than the one zlib and our blobs use, so on
+// x86-64 carry-less multiplication folding is used instead.
+#if !defined(_NUITKA_NO_HARDWARE_CRC32)
+#if (defined(__x86_64__) || defined(_M_X64)) && (__GNUC__ >= 5 || defined(__clang__) || _MSC_VER >= 1900)
+#define _NUITKA_HARDWARE_CRC32_PCLMUL 1
+#elif defined(__aarch64__) && (__GNUC__ >= 6 || defined(__clang__)) && (defined(__linux__) || defined(__APPLE__))
+#define _NUITKA_HARDWARE_CRC32_ARMV8 1
+#endif
+#endif
+
+#if _NUITKA_HARDWARE_CRC32_PCLMUL
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define NUITKA_PCLMUL_FUNCTION
+#define NUITKA_ALIGN16 __declspec(align(16))
+#else
+#include <cpuid.h>
+#define NUITKA_PCLMUL_FUNCTION __attribute__((target("sse4.1,pclmul")))
+#define NUITKA_ALIGN16 __attribute__((aligned(16)))
+#endif
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <wmmintrin.h>
+
+static bool _hasHardwareCRC32(void) {
+    unsigned int info[4] = {0, 0, 0, 0};
+
+#if defined(_MSC_VER)
+    __cpuid((int *)info, 1);
+#else
+    if (__get_cpuid(1, &info[0], &info[1], &info[2], &info[3]) == 0) {
+        return false;
+    }
+#endif
+
+    // Need PCLMULQDQ in bit 1 and SSE4.1 in bit 19 of ECX.
+    return (info[2] & (1 << 1)) != 0 && (info[2] & (1 << 19)) != 0;
+}
+
+// Folding with carry-less multiplication, following "Fast CRC Computation for
+// Generic Polynomials Using PCLMULQDQ Instruction" by Intel, with constants for
+// the bit reflected CRC32 polynomial. Works on the inverted CRC value, and
+// requires at least 64 bytes and a multiple of 16 bytes.
+NUITKA_PCLMUL_FUNCTION static uint32_t _foldCRC32_PCLMUL(uint32_t crc, unsigned char const *message, uint32_t size) {
+    static uint64_t const NUITKA_ALIGN16 k1k2[] = {0x0154442bd4, 0x01c6e41596};
+    static uint64_t const NUITKA_ALIGN16 k3k4[] = {0x01751997d0, 0x00ccaa009e};
+    static uint64_t const NUITKA_ALIGN16 k5k0[] = {0x0163cd6124, 0x0000000000};
+    static uint64_t const NUITKA_ALIGN16 poly[] = {0x01db710641, 0x01f7011641};
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = _mm_loadu_si128((__m128i const *)(message + 0x00));
+    x2 = _mm_loadu_si128((__m128i const *)(message + 0x10));
+    x3 = _mm_loadu_si128((__m128i const *)(message + 0x20));
+    x4 = _mm_loadu_si128((__m128i const *)(message + 0x30));
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+
+    x0 = _mm_load_si128((__m128i const *)k1k2);
+
+    message += 64;
+    size -= 64;
+
+    // Parallel folding of 64 bytes blocks.
+    while (size >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((__m128i const *)(message + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((__m128i const *)(message + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((__m128i const *)(message + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((__m128i const *)(message + 0x30)));
+
+        message += 64;
+        size -= 64;
+    }
+
+    // Fold the four lanes into one.
+    x0 = _mm_load_si128((__m128i const *)k3k4);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Single folding of remaining 16 bytes blocks.
+    while (size >= 16) {
+        x2 = _mm_loadu_si128((__m128i const *)message);
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+        message += 16;
+        size -= 16;
+    }
+
+    // Fold 128 bits to 64 bits.
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x0 = _mm_loadl_epi64((__m128i const *)k5k0);
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits.
+    x0 = _mm_load_si128((__m128i const *)poly);
+
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+
+static uint32_t _calcCRC32Hardware(uint32_t crc, unsigned char const *message, uint32_t size) {
+    if (size >= 64) {
+        uint32_t chunk_size = size & ~(uint32_t)15;
+
+        crc = ~_foldCRC32_PCLMUL(~crc, message, chunk_size);
+
+        message += chunk_size;
+        size -= chunk_size;
+    }
+
+    return _calcCRC32Generic(crc, message, size);
+}
+#endif
+
+#if _NUITKA_HARDWARE_CRC32_ARMV8
+#if defined(__clang__)
+#define NUITKA_ARMV8_CRC_FUNCTION __attribute__((target("crc")))
+#include <arm_acle.h>
+#else
+#define NUITKA_ARMV8_CRC_FUNCTION
+#pragma GCC push_options
+#pragma GCC target("arch=armv8-a+crc")
+#include <arm_acle.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+#endif
+
+static bool _hasHardwareCRC32(void) {
+#if defined(__APPLE__)
+    // All Apple ARM64 CPUs have the CRC32 extension.
+    return true;
+#else
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#endif
+}
+
+// The ARMv8 CRC32 instructions use the same polynomial as zlib does.
+NUITKA_ARMV8_CRC_FUNCTION static uint32_t _calcCRC32Hardware(uint32_t crc, unsigned char const *message,
+                                                             uint32_t size) {
+    crc = ~crc;
+
+    while (size >= 8) {
+        uint64_t value;
+        memcpy(&value, message, sizeof(value));
+
+        crc = __crc32d(crc, value);
+
+        message += 8;
+        size -= 8;
+    }
+
+    while (size > 0) {
+        crc = __crc32b(crc, *message);
+
+        message += 1;
+        size -= 1;
+    }
+
+    return ~crc;
+}
+
+#if !defined(__clang__)
+#pragma GCC pop_options
+#endif
+#endif
+
+#if _NUITKA_HARDWARE_CRC32_PCLMUL || _NUITKA_HARDWARE_CRC32_ARMV8
+typedef uint32_t (*crc32_func_t)(uint32_t crc, unsigned char const *message, uint32_t size);
+
+static crc32_func_t _selectCRC32(void) { return _hasHardwareCRC32() ? _calcCRC32Hardware : _calcCRC32Generic; }
+
+uint32_t calcCRC32(unsigned char const *message, uint32_t size) {
+    // Selecting more than once in case of threads racing is harmless.
+    static crc32_func_t crc32_func = NULL;
+
+    if (crc32_func == NULL) {
+        crc32_func = _selectCRC32();
+    }
+
+    return crc32_func(0, message, size);
+}
+#else
+uint32_t calcCRC32(unsigned char const *message, uint32_t size) { return _calcCRC32Generic(0, message, size); }
+#endif
@@ -1213,6 +1213,56 @@ unsigned char *findMacOSBinarySection(void) {
 
 #endif
 
+// The directory at the start of the blob, sorted by name, each entry gives
+// offsets relative to the start of the blob data, and the CRC32 of the
+// section, which is checked only when it gets loaded.
+struct Nuitka_ConstantsBlobDirectoryEntry {
+    uint32_t name_offset;
+    uint32_t data_offset;
+    uint32_t size;
+    uint32_t crc32;
+};
+
+static unsigned char const *findConstantsBlobSection(char const *name) {
+    unsigned char const *w = constant_bin;
+    uint32_t count = unpackValueUint32(&w);
+
+    uint32_t low = 0;
+    uint32_t high = count;
+
+    // Binary search in the directory, touches only the entries and names
+    // visited, and then the data of the section found.
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+
+        struct Nuitka_ConstantsBlobDirectoryEntry entry;
+        memcpy(&entry, w + middle * sizeof(entry), sizeof(entry));
+
+        int res = strcmp(name, (char const *)constant_bin + entry.name_offset);
+
+        if (res == 0) {
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_CONSTANTS
+            printf("Loading blob named '%s' with size %u at offset %u\n", name, entry.size, entry.data_offset);
+#endif
+
+#ifndef _NUITKA_CONSTANTS_NO_CHECKSUM
+            if (unlikely(calcCRC32(constant_bin + entry.data_offset, entry.size) != entry.crc32)) {
+                printf("Error, corrupted constants object '%s'\n", name);
+                abort();
+            }
+#endif
+
+            return constant_bin + entry.data_offset;
+        } else if (res < 0) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+
+    return NULL;
+}
+
 void loadConstantsBlob(PyThreadState *tstate, PyObject **output, char const *name) {
     assert(PyThreadState_GET() == tstate);
 
@@ -1247,7 +1297,9 @@ void loadConstantsBlob(PyThreadState *tstate, PyObject **output, char const *nam
         NUITKA_PRINT_TIMING("loadConstantsBlob(): Found blob, decoding now.");
         DECODE(constant_bin);
 
-        NUITKA_PRINT_TIMING("loadConstantsBlob(): CRC32 that blob for correctness.");
+        // Only the directory is checked here, the sections get checked when
+        // they are loaded, so pages of modules not imported are not touched.
+        NUITKA_PRINT_TIMING("loadConstantsBlob(): CRC32 the blob directory for correctness.");
         uint32_t hash = unpackValueUint32(&constant_bin);
         uint32_t size = unpackValueUint32(&constant_bin);
 
@@ -1255,6 +1307,8 @@ void loadConstantsBlob(PyThreadState *tstate, PyObject **output, char const *nam
         printf("loadConstantsBlob '%u' hash value\n", hash);
         printf("loadConstantsBlob '%u' size value\n", size);
 #endif
+
+#ifndef _NUITKA_CONSTANTS_NO_CHECKSUM
         if (calcCRC32(constant_bin, size) != hash) {
             puts("Error, corrupted constants object");
             abort();
@@ -1263,6 +1317,10 @@ void loadConstantsBlob(PyThreadState *tstate, PyObject **output, char const *nam
 #ifdef _NUITKA_EXPERIMENTAL_DEBUG_CONSTANTS
         printf("Checked CRC32 to match hash %u size %u\n", hash, size);
 #endif
+#else
+        (void)hash;
+        (void)size;
+#endif
 
         NUITKA_PRINT_TIMING("loadConstantsBlob(): One time init complete.");
 
@@ -1277,27 +1335,11 @@ void loadConstantsBlob(PyThreadState *tstate, PyObject **output, char const *nam
         initCaches();
     }
 
-    unsigned char const *w = constant_bin;
-
-    for (;;) {
-        int match = strcmp(name, (char const *)w);
-        w += strlen((char const *)w) + 1;
-
-#ifdef _NUITKA_EXPERIMENTAL_DEBUG_CONSTANTS
-        printf("offset of blob size %d\n", w - constant_bin);
-#endif
-
-        uint32_t size = unpackValueUint32(&w);
-
-        if (match == 0) {
-#ifdef _NUITKA_EXPERIMENTAL_DEBUG_CONSTANTS
-            printf("Loading blob named '%s' with size %d\n", name, size);
-#endif
-            break;
-        }
+    unsigned char const *w = findConstantsBlobSection(name);
 
-        // Skip other module data.
-        w += size;
+    if (unlikely(w == NULL)) {
+        printf("Error, missing constants blob part '%s'\n", name);
+        abort();
     }
 
     unpackBlobConstants(tstate, output, w);
@@ -28,6 +28,10 @@
 // spell-checker: ignore ob_shash dictiterobject dictiteritems_type dictiterkeys_type
 // spell-checker: ignore dictitervalues_type dictviewobject dictvaluesview_type dictkeysview_type
 
+#if NUITKA_DICT_HAS_VERSION_TAG
+uint64_t Nuitka_dict_version_counter = (uint64_t)1 << 63;
+#endif
+
 PyObject *DICT_GET_ITEM0(PyThreadState *tstate, PyObject *dict, PyObject *key) {
     CHECK_OBJECT(dict);
     assert(PyDict_Check(dict));
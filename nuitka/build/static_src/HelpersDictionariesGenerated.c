@@ -92,6 +92,11 @@ static PyDictObject *_Nuitka_AllocatePyDictObject(void) {
         result_mp = (PyDictObject *)Nuitka_GC_New(&PyDict_Type);
     }
 
+#if NUITKA_DICT_HAS_VERSION_TAG
+    // Freelist entries have the version of another dictionary, give a new one.
+    UPDATE_DICT_VERSION_TAG(result_mp);
+#endif
+
     return result_mp;
 }
 #endif
@@ -1194,6 +1194,20 @@ static PyObject *_BINARY_OPERATION_MULT_OBJECT_LONG_LONG(PyObject *operand1, PyO
 #pragma warning(pop)
 #endif
 
+    PyLongObject *operand1_long_object = (PyLongObject *)operand1;
+
+    PyLongObject *operand2_long_object = (PyLongObject *)operand2;
+
+    if (Py_ABS(Py_SIZE(operand1_long_object)) <= 1 && Py_ABS(Py_SIZE(operand2_long_object)) <= 1) {
+        long long r = (long long)MEDIUM_VALUE(operand1_long_object) * MEDIUM_VALUE(operand2_long_object);
+
+        // On platforms with 32 bit "long", the product need not fit.
+        if (likely(r == (long)r)) {
+            clong_result = (long)r;
+            goto exit_result_ok_clong;
+        }
+    }
+
     PyObject *x = PyLong_Type.tp_as_number->nb_multiply(operand1, operand2);
     assert(x != Py_NotImplemented);
 
@@ -1207,6 +1221,10 @@ exit_result_object:
     result = obj_result;
     goto exit_result_ok;
 
+exit_result_ok_clong:
+    result = Nuitka_LongFromCLong(clong_result);
+    goto exit_result_ok;
+
 exit_result_ok:
     return result;
 
@@ -1392,6 +1410,20 @@ static PyObject *_BINARY_OPERATION_MULT_OBJECT_OBJECT_LONG(PyObject *operand1, P
 #pragma warning(pop)
 #endif
 
+        PyLongObject *operand1_long_object = (PyLongObject *)operand1;
+
+        PyLongObject *operand2_long_object = (PyLongObject *)operand2;
+
+        if (Py_ABS(Py_SIZE(operand1_long_object)) <= 1 && Py_ABS(Py_SIZE(operand2_long_object)) <= 1) {
+            long long r = (long long)MEDIUM_VALUE(operand1_long_object) * MEDIUM_VALUE(operand2_long_object);
+
+            // On platforms with 32 bit "long", the product need not fit.
+            if (likely(r == (long)r)) {
+                clong_result = (long)r;
+                goto exit_result_ok_clong;
+            }
+        }
+
         PyObject *x = PyLong_Type.tp_as_number->nb_multiply(operand1, operand2);
         assert(x != Py_NotImplemented);
 
@@ -1405,6 +1437,10 @@ static PyObject *_BINARY_OPERATION_MULT_OBJECT_OBJECT_LONG(PyObject *operand1, P
         result = obj_result;
         goto exit_result_ok;
 
+    exit_result_ok_clong:
+        result = Nuitka_LongFromCLong(clong_result);
+        goto exit_result_ok;
+
     exit_result_ok:
         return result;
 
@@ -1607,6 +1643,20 @@ static PyObject *_BINARY_OPERATION_MULT_OBJECT_LONG_OBJECT(PyObject *operand1, P
 #pragma warning(pop)
 #endif
 
+        PyLongObject *operand1_long_object = (PyLongObject *)operand1;
+
+        PyLongObject *operand2_long_object = (PyLongObject *)operand2;
+
+        if (Py_ABS(Py_SIZE(operand1_long_object)) <= 1 && Py_ABS(Py_SIZE(operand2_long_object)) <= 1) {
+            long long r = (long long)MEDIUM_VALUE(operand1_long_object) * MEDIUM_VALUE(operand2_long_object);
+
+            // On platforms with 32 bit "long", the product need not fit.
+            if (likely(r == (long)r)) {
+                clong_result = (long)r;
+                goto exit_result_ok_clong;
+            }
+        }
+
         PyObject *x = PyLong_Type.tp_as_number->nb_multiply(operand1, operand2);
         assert(x != Py_NotImplemented);
 
@@ -1620,6 +1670,10 @@ static PyObject *_BINARY_OPERATION_MULT_OBJECT_LONG_OBJECT(PyObject *operand1, P
         result = obj_result;
         goto exit_result_ok;
 
+    exit_result_ok_clong:
+        result = Nuitka_LongFromCLong(clong_result);
+        goto exit_result_ok;
+
     exit_result_ok:
         return result;
 
@@ -1654,6 +1708,20 @@ static nuitka_bool _BINARY_OPERATION_MULT_NBOOL_LONG_LONG(PyObject *operand1, Py
 #pragma warning(pop)
 #endif
 
+    PyLongObject *operand1_long_object = (PyLongObject *)operand1;
+
+    PyLongObject *operand2_long_object = (PyLongObject *)operand2;
+
+    if (Py_ABS(Py_SIZE(operand1_long_object)) <= 1 && Py_ABS(Py_SIZE(operand2_long_object)) <= 1) {
+        long long r = (long long)MEDIUM_VALUE(operand1_long_object) * MEDIUM_VALUE(operand2_long_object);
+
+        // On platforms with 32 bit "long", the product need not fit.
+        if (likely(r == (long)r)) {
+            clong_result = (long)r;
+            goto exit_result_ok_clong;
+        }
+    }
+
     PyObject *x = PyLong_Type.tp_as_number->nb_multiply(operand1, operand2);
     assert(x != Py_NotImplemented);
 
@@ -1668,6 +1736,10 @@ exit_result_object:
     Py_DECREF(obj_result);
     goto exit_result_ok;
 
+exit_result_ok_clong:
+    result = clong_result != 0 ? NUITKA_BOOL_TRUE : NUITKA_BOOL_FALSE;
+    goto exit_result_ok;
+
 exit_result_ok:
     return result;
 
@@ -1861,6 +1933,20 @@ static nuitka_bool _BINARY_OPERATION_MULT_NBOOL_OBJECT_LONG(PyObject *operand1,
 #pragma warning(pop)
 #endif
 
+        PyLongObject *operand1_long_object = (PyLongObject *)operand1;
+
+        PyLongObject *operand2_long_object = (PyLongObject *)operand2;
+
+        if (Py_ABS(Py_SIZE(operand1_long_object)) <= 1 && Py_ABS(Py_SIZE(operand2_long_object)) <= 1) {
+            long long r = (long long)MEDIUM_VALUE(operand1_long_object) * MEDIUM_VALUE(operand2_long_object);
+
+            // On platforms with 32 bit "long", the product need not fit.
+            if (likely(r == (long)r)) {
+                clong_result = (long)r;
+                goto exit_result_ok_clong;
+            }
+        }
+
         PyObject *x = PyLong_Type.tp_as_number->nb_multiply(operand1, operand2);
         assert(x != Py_NotImplemented);
 
@@ -1875,6 +1961,10 @@ static nuitka_bool _BINARY_OPERATION_MULT_NBOOL_OBJECT_LONG(PyObject *operand1,
         Py_DECREF(obj_result);
         goto exit_result_ok;
 
+    exit_result_ok_clong:
+        result = clong_result != 0 ? NUITKA_BOOL_TRUE : NUITKA_BOOL_FALSE;
+        goto exit_result_ok;
+
     exit_result_ok:
         return result;
 
@@ -2085,6 +2175,20 @@ static nuitka_bool _BINARY_OPERATION_MULT_NBOOL_LONG_OBJECT(PyObject *operand1,
 #pragma warning(pop)
 #endif
 
+        PyLongObject *operand1_long_object = (PyLongObject *)operand1;
+
+        PyLongObject *operand2_long_object = (PyLongObject *)operand2;
+
+        if (Py_ABS(Py_SIZE(operand1_long_object)) <= 1 && Py_ABS(Py_SIZE(operand2_long_object)) <= 1) {
+            long long r = (long long)MEDIUM_VALUE(operand1_long_object) * MEDIUM_VALUE(operand2_long_object);
+
+            // On platforms with 32 bit "long", the product need not fit.
+            if (likely(r == (long)r)) {
+                clong_result = (long)r;
+                goto exit_result_ok_clong;
+            }
+        }
+
         PyObject *x = PyLong_Type.tp_as_number->nb_multiply(operand1, operand2);
         assert(x != Py_NotImplemented);
 
@@ -2099,6 +2203,10 @@ static nuitka_bool _BINARY_OPERATION_MULT_NBOOL_LONG_OBJECT(PyObject *operand1,
         Py_DECREF(obj_result);
         goto exit_result_ok;
 
+    exit_result_ok_clong:
+        result = clong_result != 0 ? NUITKA_BOOL_TRUE : NUITKA_BOOL_FALSE;
+        goto exit_result_ok;
+
     exit_result_ok:
         return result;
 
@@ -683,6 +683,27 @@ static inline bool _INPLACE_OPERATION_MULT_LONG_LONG(PyObject **operand1, PyObje
 #pragma warning(pop)
 #endif
 
+    PyLongObject *operand1_long_object = (PyLongObject *)*operand1;
+
+    PyLongObject *operand2_long_object = (PyLongObject *)operand2;
+
+    if (Py_ABS(Py_SIZE(operand1_long_object)) <= 1 && Py_ABS(Py_SIZE(operand2_long_object)) <= 1) {
+        long long r = (long long)MEDIUM_VALUE(operand1_long_object) * MEDIUM_VALUE(operand2_long_object);
+
+        // On platforms with 32 bit "long", the product need not fit.
+        if (likely(r == (long)r)) {
+            if (Py_REFCNT(*operand1) == 1) {
+                Nuitka_LongUpdateFromCLong(&*operand1, (long)r);
+                goto exit_result_ok;
+            } else {
+                PyObject *obj = Nuitka_LongFromCLong((long)r);
+
+                obj_result = obj;
+                goto exit_result_object;
+            }
+        }
+    }
+
     PyObject *x = PyLong_Type.tp_as_number->nb_multiply(*operand1, operand2);
     assert(x != Py_NotImplemented);
 
@@ -912,6 +933,27 @@ static inline bool _INPLACE_OPERATION_MULT_OBJECT_LONG(PyObject **operand1, PyOb
 #pragma warning(pop)
 #endif
 
+        PyLongObject *operand1_long_object = (PyLongObject *)*operand1;
+
+        PyLongObject *operand2_long_object = (PyLongObject *)operand2;
+
+        if (Py_ABS(Py_SIZE(operand1_long_object)) <= 1 && Py_ABS(Py_SIZE(operand2_long_object)) <= 1) {
+            long long r = (long long)MEDIUM_VALUE(operand1_long_object) * MEDIUM_VALUE(operand2_long_object);
+
+            // On platforms with 32 bit "long", the product need not fit.
+            if (likely(r == (long)r)) {
+                if (Py_REFCNT(*operand1) == 1) {
+                    Nuitka_LongUpdateFromCLong(&*operand1, (long)r);
+                    goto exit_result_ok;
+                } else {
+                    PyObject *obj = Nuitka_LongFromCLong((long)r);
+
+                    obj_result = obj;
+                    goto exit_result_object;
+                }
+            }
+        }
+
         PyObject *x = PyLong_Type.tp_as_number->nb_multiply(*operand1, operand2);
         assert(x != Py_NotImplemented);
 
@@ -1146,6 +1188,27 @@ static inline bool _INPLACE_OPERATION_MULT_LONG_OBJECT(PyObject **operand1, PyOb
 #pragma warning(pop)
 #endif
 
+        PyLongObject *operand1_long_object = (PyLongObject *)*operand1;
+
+        PyLongObject *operand2_long_object = (PyLongObject *)operand2;
+
+        if (Py_ABS(Py_SIZE(operand1_long_object)) <= 1 && Py_ABS(Py_SIZE(operand2_long_object)) <= 1) {
+            long long r = (long long)MEDIUM_VALUE(operand1_long_object) * MEDIUM_VALUE(operand2_long_object);
+
+            // On platforms with 32 bit "long", the product need not fit.
+            if (likely(r == (long)r)) {
+                if (Py_REFCNT(*operand1) == 1) {
+                    Nuitka_LongUpdateFromCLong(&*operand1, (long)r);
+                    goto exit_result_ok;
+                } else {
+                    PyObject *obj = Nuitka_LongFromCLong((long)r);
+
+                    obj_result = obj;
+                    goto exit_result_object;
+                }
+            }
+        }
+
         PyObject *x = PyLong_Type.tp_as_number->nb_multiply(*operand1, operand2);
         assert(x != Py_NotImplemented);
 
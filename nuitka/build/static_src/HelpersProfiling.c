@@ -16,7 +16,8 @@
 //     limitations under the License.
 //
 /**
- * This is responsible for profiling Nuitka using "vmprof".
+ * This is responsible for profiling Nuitka using "vmprof", and for the built-in
+ * sampling profiler that is enabled by environment variable at run time.
  */
 
 #if _NUITKA_PROFILE
@@ -101,3 +102,352 @@ void stopProfiling(void) {
 }
 
 #endif
+
+#if _NUITKA_SAMPLING_PROFILER
+
+// This is the built-in sampling profiler. When "NUITKA_SAMPLING_PROFILE" is set
+// to a filename, a profiling timer signal interrupts the program, and the
+// handler walks the frame chain of the thread holding the GIL, compiled frames
+// and uncompiled ones alike. The stacks are aggregated in tables that are all
+// allocated up front, since the handler cannot allocate memory, and written in
+// collapsed stack format, as used by "flamegraph.pl" and "speedscope", at exit.
+// The sampling interval in microseconds can be given with the environment
+// variable "NUITKA_SAMPLING_PROFILE_INTERVAL".
+
+#include <signal.h>
+#include <sys/time.h>
+
+#define SAMPLING_PROFILER_DEFAULT_INTERVAL 10000
+
+// Limits of the profile, samples that do not fit anymore are only counted. The
+// table sizes must be powers of two.
+#define SAMPLING_PROFILER_MAX_DEPTH 256
+#define SAMPLING_PROFILER_CODES_SIZE 16384
+#define SAMPLING_PROFILER_STACKS_SIZE 65536
+#define SAMPLING_PROFILER_FRAMES_SIZE (1024 * 1024)
+#define SAMPLING_PROFILER_NAMES_SIZE (1024 * 1024)
+
+struct Nuitka_SamplingCodeEntry {
+    // The code object, and the values we copied names from, used to detect
+    // code objects that were released and whose memory got reused.
+    PyCodeObject *code;
+    PyObject *name;
+    PyObject *filename;
+
+    // Offsets into the name storage.
+    uint32_t name_offset;
+    uint32_t filename_offset;
+};
+
+struct Nuitka_SamplingFrame {
+    uint32_t code_index;
+    int line;
+};
+
+struct Nuitka_SamplingStackEntry {
+    uint64_t count;
+    uint32_t hash;
+    uint32_t depth;
+    uint32_t frames_offset;
+};
+
+static struct Nuitka_SamplingCodeEntry *sampling_codes;
+static uint32_t sampling_codes_used;
+
+static struct Nuitka_SamplingStackEntry *sampling_stacks;
+static uint32_t sampling_stacks_used;
+
+static struct Nuitka_SamplingFrame *sampling_frames;
+static uint32_t sampling_frames_used;
+
+static char *sampling_names;
+static uint32_t sampling_names_used;
+
+// Samples taken while no thread had the GIL, e.g. in blocking calls, and
+// samples that did not fit into the tables.
+static uint64_t sampling_without_gil;
+static uint64_t sampling_dropped;
+
+static char const *sampling_output_filename;
+static struct sigaction sampling_old_action;
+
+static uint32_t _addSamplingName(char const *data, Py_ssize_t size) {
+    if (sampling_names_used + size + 1 > SAMPLING_PROFILER_NAMES_SIZE) {
+        // The first name stored is "?" for use in this case.
+        return 0;
+    }
+
+    uint32_t result = sampling_names_used;
+
+    memcpy(sampling_names + result, data, size);
+    sampling_names[result + size] = 0;
+
+    sampling_names_used += (uint32_t)size + 1;
+
+    return result;
+}
+
+static uint32_t addSamplingName(PyObject *value) {
+    // Only names that are readily available as UTF-8 can be used, converting
+    // them is not possible in a signal handler.
+    if (value != NULL && PyUnicode_Check(value) && PyUnicode_IS_READY(value)) {
+        if (PyUnicode_IS_COMPACT_ASCII(value)) {
+            return _addSamplingName((char const *)(((PyASCIIObject *)value) + 1), ((PyASCIIObject *)value)->length);
+        } else if (PyUnicode_IS_COMPACT(value) && ((PyCompactUnicodeObject *)value)->utf8 != NULL) {
+            return _addSamplingName(((PyCompactUnicodeObject *)value)->utf8,
+                                    ((PyCompactUnicodeObject *)value)->utf8_length);
+        }
+    }
+
+    return 0;
+}
+
+static int getSamplingCodeIndex(PyCodeObject *code) {
+#if PYTHON_VERSION < 0x3b0
+    PyObject *name = code->co_name;
+#else
+    PyObject *name = code->co_qualname;
+#endif
+    PyObject *filename = code->co_filename;
+
+    uint32_t mask = SAMPLING_PROFILER_CODES_SIZE - 1;
+    uint32_t index = (uint32_t)(((uintptr_t)code) >> 4) & mask;
+
+    for (;;) {
+        struct Nuitka_SamplingCodeEntry *entry = &sampling_codes[index];
+
+        if (entry->code == NULL) {
+            // Keep the table sparse enough for the probing to terminate quickly.
+            if (sampling_codes_used >= SAMPLING_PROFILER_CODES_SIZE / 2) {
+                return -1;
+            }
+
+            entry->code = code;
+            entry->name = name;
+            entry->filename = filename;
+            entry->name_offset = addSamplingName(name);
+            entry->filename_offset = addSamplingName(filename);
+
+            sampling_codes_used += 1;
+
+            return (int)index;
+        }
+
+        if (entry->code == code && entry->name == name && entry->filename == filename) {
+            return (int)index;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+static void recordSamplingStack(struct Nuitka_SamplingFrame const *frames, uint32_t depth) {
+    // FNV-1a over the frames.
+    uint32_t hash = 2166136261U;
+
+    for (uint32_t i = 0; i < depth; i++) {
+        hash = (hash ^ frames[i].code_index) * 16777619U;
+        hash = (hash ^ (uint32_t)frames[i].line) * 16777619U;
+    }
+
+    uint32_t mask = SAMPLING_PROFILER_STACKS_SIZE - 1;
+    uint32_t index = hash & mask;
+
+    for (;;) {
+        struct Nuitka_SamplingStackEntry *entry = &sampling_stacks[index];
+
+        if (entry->count == 0) {
+            if (sampling_stacks_used >= SAMPLING_PROFILER_STACKS_SIZE / 2 ||
+                sampling_frames_used + depth > SAMPLING_PROFILER_FRAMES_SIZE) {
+                sampling_dropped += 1;
+                return;
+            }
+
+            memcpy(sampling_frames + sampling_frames_used, frames, depth * sizeof(struct Nuitka_SamplingFrame));
+
+            entry->hash = hash;
+            entry->depth = depth;
+            entry->frames_offset = sampling_frames_used;
+            entry->count = 1;
+
+            sampling_frames_used += depth;
+            sampling_stacks_used += 1;
+
+            return;
+        }
+
+        if (entry->hash == hash && entry->depth == depth &&
+            memcmp(sampling_frames + entry->frames_offset, frames, depth * sizeof(struct Nuitka_SamplingFrame)) == 0) {
+            entry->count += 1;
+            return;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+static void onSamplingProfilerSignal(int signal_number) {
+    int saved_errno = errno;
+
+    // Only the thread holding the GIL has frames that are not changing while
+    // we look at them, that also makes this the only writer of the tables.
+    PyThreadState *tstate = _PyThreadState_UncheckedGet();
+
+    if (tstate == NULL || tstate != PyGILState_GetThisThreadState()) {
+        sampling_without_gil += 1;
+
+        errno = saved_errno;
+        return;
+    }
+
+    struct Nuitka_SamplingFrame frames[SAMPLING_PROFILER_MAX_DEPTH];
+    uint32_t depth = 0;
+
+    Nuitka_ThreadStateFrameType *frame = _Nuitka_GetThreadStateFrame(tstate);
+
+    while (frame != NULL && depth < SAMPLING_PROFILER_MAX_DEPTH) {
+        int line;
+
+#if PYTHON_VERSION < 0x3b0
+        if (Nuitka_Frame_Check((PyObject *)frame)) {
+            line = frame->f_lineno;
+        } else {
+            line = PyFrame_GetLineNumber(frame);
+        }
+#else
+        if (frame->frame_obj != NULL && Nuitka_Frame_Check((PyObject *)frame->frame_obj)) {
+            line = frame->frame_obj->f_lineno;
+        } else if (_PyFrame_IsIncomplete(frame)) {
+            frame = frame->previous;
+            continue;
+        } else {
+            line = PyCode_Addr2Line(frame->f_code, _PyInterpreterFrame_LASTI(frame) * sizeof(_Py_CODEUNIT));
+        }
+#endif
+
+        int code_index = getSamplingCodeIndex(frame->f_code);
+
+        if (unlikely(code_index < 0)) {
+            sampling_dropped += 1;
+
+            errno = saved_errno;
+            return;
+        }
+
+        frames[depth].code_index = (uint32_t)code_index;
+        frames[depth].line = line;
+        depth += 1;
+
+#if PYTHON_VERSION < 0x3b0
+        frame = frame->f_back;
+#else
+        frame = frame->previous;
+#endif
+    }
+
+    if (depth > 0) {
+        recordSamplingStack(frames, depth);
+    }
+
+    errno = saved_errno;
+}
+
+void startSamplingProfiler(void) {
+    sampling_output_filename = getenv("NUITKA_SAMPLING_PROFILE");
+
+    if (sampling_output_filename == NULL || *sampling_output_filename == 0) {
+        sampling_output_filename = NULL;
+        return;
+    }
+
+    long interval = SAMPLING_PROFILER_DEFAULT_INTERVAL;
+    char const *interval_value = getenv("NUITKA_SAMPLING_PROFILE_INTERVAL");
+
+    if (interval_value != NULL && atol(interval_value) > 0) {
+        interval = atol(interval_value);
+    }
+
+    sampling_codes = (struct Nuitka_SamplingCodeEntry *)calloc(SAMPLING_PROFILER_CODES_SIZE,
+                                                               sizeof(struct Nuitka_SamplingCodeEntry));
+    sampling_stacks = (struct Nuitka_SamplingStackEntry *)calloc(SAMPLING_PROFILER_STACKS_SIZE,
+                                                                 sizeof(struct Nuitka_SamplingStackEntry));
+    sampling_frames =
+        (struct Nuitka_SamplingFrame *)malloc(SAMPLING_PROFILER_FRAMES_SIZE * sizeof(struct Nuitka_SamplingFrame));
+    sampling_names = (char *)malloc(SAMPLING_PROFILER_NAMES_SIZE);
+
+    if (sampling_codes == NULL || sampling_stacks == NULL || sampling_frames == NULL || sampling_names == NULL) {
+        fprintf(stderr, "Nuitka: Could not allocate memory for sampling profiler.\n");
+        sampling_output_filename = NULL;
+        return;
+    }
+
+    _addSamplingName("?", 1);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = onSamplingProfilerSignal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+
+    sigaction(SIGPROF, &action, &sampling_old_action);
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = interval / 1000000;
+    timer.it_interval.tv_usec = interval % 1000000;
+    timer.it_value = timer.it_interval;
+
+    setitimer(ITIMER_PROF, &timer, NULL);
+}
+
+void stopSamplingProfiler(void) {
+    if (sampling_output_filename == NULL) {
+        return;
+    }
+
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, NULL);
+
+    sigaction(SIGPROF, &sampling_old_action, NULL);
+
+    FILE *output = fopen(sampling_output_filename, "w");
+
+    if (output == NULL) {
+        fprintf(stderr, "Nuitka: Could not write sampling profile to '%s'.\n", sampling_output_filename);
+        return;
+    }
+
+    for (uint32_t i = 0; i < SAMPLING_PROFILER_STACKS_SIZE; i++) {
+        struct Nuitka_SamplingStackEntry const *entry = &sampling_stacks[i];
+
+        if (entry->count == 0) {
+            continue;
+        }
+
+        struct Nuitka_SamplingFrame const *frames = sampling_frames + entry->frames_offset;
+
+        // Collapsed stacks start with the outermost frame.
+        for (uint32_t j = entry->depth; j > 0; j--) {
+            struct Nuitka_SamplingCodeEntry const *code_entry = &sampling_codes[frames[j - 1].code_index];
+
+            fprintf(output, "%s%s (%s:%d)", j == entry->depth ? "" : ";", sampling_names + code_entry->name_offset,
+                    sampling_names + code_entry->filename_offset, frames[j - 1].line);
+        }
+
+        fprintf(output, " %llu\n", (unsigned long long)entry->count);
+    }
+
+    if (sampling_without_gil != 0) {
+        fprintf(output, "<without GIL> %llu\n", (unsigned long long)sampling_without_gil);
+    }
+
+    if (sampling_dropped != 0) {
+        fprintf(output, "<dropped> %llu\n", (unsigned long long)sampling_dropped);
+    }
+
+    fclose(output);
+
+    sampling_output_filename = NULL;
+}
+
+#endif
@@ -28,34 +28,155 @@
 
 static FILE *pgo_output;
 
-// Saving space by not repeating strings.
+// Probes are collected in a buffer, and only written in blocks, all calls
+// happen with the GIL held, so one buffer serves all threads.
+static unsigned char PGO_buffer[65536];
+static size_t PGO_buffer_used = 0;
 
-// Allocated strings
-static char const **PGO_ProbeNameMappings = NULL;
-static int PGO_ProbeNameMappings_size = 0;
+static void PGO_flushBuffer(void) {
+    if (PGO_buffer_used != 0) {
+        fwrite(PGO_buffer, 1, PGO_buffer_used, pgo_output);
+        PGO_buffer_used = 0;
+    }
+}
+
+static void PGO_writeBytes(void const *value, size_t size) {
+    assert(size <= sizeof(PGO_buffer));
+
+    if (unlikely(PGO_buffer_used + size > sizeof(PGO_buffer))) {
+        PGO_flushBuffer();
+    }
+
+    memcpy(PGO_buffer + PGO_buffer_used, value, size);
+    PGO_buffer_used += size;
+}
+
+// Saving space by not repeating strings. These are interned by contents in a
+// hash table, and copied, as not all of them live for the whole program. The
+// entries also hold the counters of the probes named by them.
+struct PGO_StringEntry {
+    char const *str;
+    uint32_t hash;
+    uint32_t id;
+
+    uint64_t function_calls;
+    uint64_t branch_counts[2];
+};
+
+static struct PGO_StringEntry *PGO_StringTable = NULL;
+static uint32_t PGO_StringTable_size = 0;
+
+// Entries by their ID, in the order of appearance.
+static struct PGO_StringEntry **PGO_ProbeNameMappings = NULL;
+static uint32_t PGO_ProbeNameMappings_size = 0;
 static uint32_t PGO_ProbeNameMappings_used = 0;
 
-int PGO_getStringID(char const *str) {
-    for (int i = 0; i < PGO_ProbeNameMappings_used; i++) {
-        if (str == PGO_ProbeNameMappings[i]) {
-            return i;
+static uint32_t PGO_hashString(char const *str) {
+    // FNV-1a hash
+    uint32_t hash = 2166136261U;
+
+    while (*str != 0) {
+        hash ^= (unsigned char)*str++;
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+static struct PGO_StringEntry *PGO_findStringSlot(struct PGO_StringEntry *table, uint32_t size, char const *str,
+                                                  uint32_t hash) {
+    uint32_t mask = size - 1;
+    uint32_t index = hash & mask;
+
+    for (;;) {
+        struct PGO_StringEntry *entry = &table[index];
+
+        if (entry->str == NULL || (entry->hash == hash && strcmp(entry->str, str) == 0)) {
+            return entry;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+static void PGO_growStringTable(void) {
+    uint32_t old_size = PGO_StringTable_size;
+    struct PGO_StringEntry *old_table = PGO_StringTable;
+
+    PGO_StringTable_size = old_size == 0 ? 4096 : old_size * 2;
+    PGO_StringTable = (struct PGO_StringEntry *)calloc(PGO_StringTable_size, sizeof(struct PGO_StringEntry));
+
+    if (unlikely(PGO_StringTable == NULL)) {
+        NUITKA_CANNOT_GET_HERE("PGO string table allocation failed");
+    }
+
+    for (uint32_t i = 0; i < old_size; i++) {
+        if (old_table[i].str != NULL) {
+            struct PGO_StringEntry *entry =
+                PGO_findStringSlot(PGO_StringTable, PGO_StringTable_size, old_table[i].str, old_table[i].hash);
+            *entry = old_table[i];
+
+            PGO_ProbeNameMappings[entry->id] = entry;
         }
     }
 
+    free(old_table);
+}
+
+static struct PGO_StringEntry *PGO_getStringEntry(char const *str);
+
+static void PGO_initStringTable(void) {
+    PGO_growStringTable();
+
+    // The ID 0 is never a probe name, generated code uses it for probe sites
+    // that did not intern their name yet.
+    PGO_getStringEntry("END");
+}
+
+static struct PGO_StringEntry *PGO_getStringEntry(char const *str) {
+    if (unlikely(PGO_StringTable_size == 0)) {
+        PGO_initStringTable();
+    }
+
+    uint32_t hash = PGO_hashString(str);
+
+    struct PGO_StringEntry *entry = PGO_findStringSlot(PGO_StringTable, PGO_StringTable_size, str, hash);
+
+    if (likely(entry->str != NULL)) {
+        return entry;
+    }
+
+    // Keep the load factor at most one half.
+    if ((PGO_ProbeNameMappings_used + 1) * 2 > PGO_StringTable_size) {
+        PGO_growStringTable();
+        entry = PGO_findStringSlot(PGO_StringTable, PGO_StringTable_size, str, hash);
+    }
+
     if (PGO_ProbeNameMappings_used == PGO_ProbeNameMappings_size) {
         PGO_ProbeNameMappings_size += 10000;
-        PGO_ProbeNameMappings = realloc(PGO_ProbeNameMappings, PGO_ProbeNameMappings_size);
+        PGO_ProbeNameMappings = (struct PGO_StringEntry **)realloc(
+            PGO_ProbeNameMappings, PGO_ProbeNameMappings_size * sizeof(struct PGO_StringEntry *));
+
+        if (unlikely(PGO_ProbeNameMappings == NULL)) {
+            NUITKA_CANNOT_GET_HERE("PGO string mapping allocation failed");
+        }
     }
 
-    PGO_ProbeNameMappings[PGO_ProbeNameMappings_used] = str;
+    entry->str = strdup(str);
+    entry->hash = hash;
+    entry->id = PGO_ProbeNameMappings_used;
+
+    PGO_ProbeNameMappings[PGO_ProbeNameMappings_used] = entry;
     PGO_ProbeNameMappings_used += 1;
 
-    return PGO_ProbeNameMappings_used - 1;
+    return entry;
 }
 
+uint32_t PGO_getStringID(char const *str) { return PGO_getStringEntry(str)->id; }
+
 static void PGO_writeString(char const *value) {
     uint32_t id = PGO_getStringID(value);
-    fwrite(&id, sizeof(id), 1, pgo_output);
+    PGO_writeBytes(&id, sizeof(id));
 }
 
 void PGO_Initialize(void) {
@@ -69,7 +190,7 @@ void PGO_Initialize(void) {
 
     pgo_output = fopen(output_filename, "wb");
 
-    if (unlikely(output_filename == NULL)) {
+    if (unlikely(pgo_output == NULL)) {
         fprintf(stderr, "Error, failed to open '%s' for writing.", output_filename);
         exit(27);
     }
@@ -77,17 +198,45 @@ void PGO_Initialize(void) {
     fputs("KAY.PGO", pgo_output);
     fflush(pgo_output);
 
-    PGO_ProbeNameMappings_size = 10000;
-    PGO_ProbeNameMappings = malloc(PGO_ProbeNameMappings_size * sizeof(char const *));
+    if (PGO_StringTable_size == 0) {
+        PGO_initStringTable();
+    }
 }
 
 void PGO_Finalize(void) {
-    PGO_writeString("END");
+    // Intern the record names first, adding strings may grow the table and
+    // move the entries while we walk them.
+    uint32_t function_calls_id = PGO_getStringID("FunctionCalls");
+    uint32_t branch_outcomes_id = PGO_getStringID("BranchOutcomes");
+    uint32_t end_id = PGO_getStringID("END");
+
+    // The counters are only written at the end, one record per probe name.
+    uint32_t used = PGO_ProbeNameMappings_used;
+
+    for (uint32_t i = 0; i < used; i++) {
+        struct PGO_StringEntry const *entry = PGO_ProbeNameMappings[i];
+
+        if (entry->function_calls != 0) {
+            PGO_writeBytes(&function_calls_id, sizeof(function_calls_id));
+            PGO_writeBytes(&entry->id, sizeof(entry->id));
+            PGO_writeBytes(&entry->function_calls, sizeof(entry->function_calls));
+        }
+
+        if (entry->branch_counts[0] != 0 || entry->branch_counts[1] != 0) {
+            PGO_writeBytes(&branch_outcomes_id, sizeof(branch_outcomes_id));
+            PGO_writeBytes(&entry->id, sizeof(entry->id));
+            PGO_writeBytes(&entry->branch_counts[1], sizeof(entry->branch_counts[1]));
+            PGO_writeBytes(&entry->branch_counts[0], sizeof(entry->branch_counts[0]));
+        }
+    }
+
+    PGO_writeBytes(&end_id, sizeof(end_id));
+    PGO_flushBuffer();
 
     uint32_t offset = (uint32_t)ftell(pgo_output);
 
-    for (int i = 0; i < PGO_ProbeNameMappings_used; i++) {
-        fputs(PGO_ProbeNameMappings[i], pgo_output);
+    for (uint32_t i = 0; i < PGO_ProbeNameMappings_used; i++) {
+        fputs(PGO_ProbeNameMappings[i]->str, pgo_output);
         fputc(0, pgo_output);
     }
 
@@ -102,9 +251,16 @@ void PGO_onProbePassed(char const *probe_str, char const *module_name, uint32_t
     PGO_writeString(probe_str);
     PGO_writeString(module_name);
     // TODO: Variable args depending on probe type?
-    fwrite(&probe_arg, sizeof(probe_arg), 1, pgo_output);
+    PGO_writeBytes(&probe_arg, sizeof(probe_arg));
 }
 
 void PGO_onModuleEntered(char const *module_name) { PGO_onProbePassed("ModuleEnter", module_name, 0); }
 void PGO_onModuleExit(char const *module_name, bool error) { PGO_onProbePassed("ModuleExit", module_name, error); }
 void PGO_onTechnicalModule(char const *module_name) { PGO_onProbePassed("ModuleTechnical", module_name, 0); }
+
+// These are passed very often, so they are only counted, and get the ID of
+// their interned name from the probe site.
+void PGO_onFunctionEntered(uint32_t probe_id) { PGO_ProbeNameMappings[probe_id]->function_calls += 1; }
+void PGO_onBranchPassed(uint32_t probe_id, bool taken) {
+    PGO_ProbeNameMappings[probe_id]->branch_counts[taken ? 1 : 0] += 1;
+}
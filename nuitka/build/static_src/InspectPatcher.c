@@ -291,12 +291,14 @@ void patchTypeComparison(void) {
 
 #include "nuitka/freelists.h"
 
+#ifndef MAX_TRACEBACK_FREE_LIST_COUNT
 #define MAX_TRACEBACK_FREE_LIST_COUNT 1000
-static PyTracebackObject *free_list_tracebacks = NULL;
-static int free_list_tracebacks_count = 0;
+#endif
+NUITKA_DECLARE_FREELIST(free_list_tracebacks, PyTracebackObject);
 
 // Create a traceback for a given frame, using a free list hacked into the
-// existing type.
+// existing type. This is done eagerly, a deferred record would still have to
+// hold the frame with its attached locals, which is the actual cost.
 PyTracebackObject *MAKE_TRACEBACK(struct Nuitka_FrameObject *frame, int lineno) {
 #if 0
     PRINT_STRING("MAKE_TRACEBACK: Enter");
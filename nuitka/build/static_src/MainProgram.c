@@ -337,6 +337,16 @@ static wchar_t **convertCommandLineParameters(int argc, char **argv) {
 #endif
 
 #if _DEBUG_REFCOUNTS
+#include "nuitka/freelists.h"
+
+static void PRINT_FREE_LIST_BINS(char const *name, int const *hits, int const *misses) {
+    for (int i = 0; i < NUITKA_FREELIST_BINS; i++) {
+        if (hits[i] != 0 || misses[i] != 0) {
+            PRINT_FORMAT("%s Bin %d: %d | %d\n", name, i, hits[i], misses[i]);
+        }
+    }
+}
+
 static void PRINT_REFCOUNTS(void) {
     // spell-checker: ignore Asend, Athrow
 
@@ -369,6 +379,22 @@ static void PRINT_REFCOUNTS(void) {
     PRINT_FORMAT("Cached Frames: %d | %d | %d | %d\n", count_active_frame_cache_instances,
                  count_allocated_frame_cache_instances, count_released_frame_cache_instances,
                  count_hit_frame_cache_instances);
+    PRINT_STRING("FREE LIST bins at program end:\n");
+    PRINT_STRING("bin | hits | misses\n");
+    PRINT_FREE_LIST_BINS("Frames", count_hit_free_list_frames, count_miss_free_list_frames);
+    PRINT_FREE_LIST_BINS("Generators", count_hit_free_list_generators, count_miss_free_list_generators);
+#if PYTHON_VERSION >= 0x350
+    PRINT_FREE_LIST_BINS("Coroutines", count_hit_free_list_coros, count_miss_free_list_coros);
+#endif
+#if PYTHON_VERSION >= 0x360
+    PRINT_FREE_LIST_BINS("Asyncgens", count_hit_free_list_asyncgens, count_miss_free_list_asyncgens);
+#endif
+#if PYTHON_VERSION >= 0x300 && PYTHON_VERSION < 0x3b0
+    PRINT_STRING("METHOD CALL cache at program end:\n");
+    PRINT_STRING("hits | misses | invalidations | uncacheable\n");
+    PRINT_FORMAT("Method Calls: %d | %d | %d | %d\n", count_hit_method_call_cache, count_miss_method_call_cache,
+                 count_invalidated_method_call_cache, count_uncacheable_method_call_cache);
+#endif
 }
 #endif
 
@@ -1537,6 +1563,11 @@ orig_argv = argv;
     startProfiling();
 #endif
 
+#if _NUITKA_SAMPLING_PROFILER
+    // Sampling profiling if requested by environment variable.
+    startSamplingProfiler();
+#endif
+
 #if _NUITKA_PGO_PYTHON
     // Profiling with our own Python PGO if enabled.
     PGO_Initialize();
@@ -1656,6 +1687,10 @@ orig_argv = argv;
     }
 #endif
 
+#if _NUITKA_SAMPLING_PROFILER
+    stopSamplingProfiler();
+#endif
+
 #if _NUITKA_PROFILE
     stopProfiling();
 #endif
@@ -62,6 +62,7 @@ static inline bool isVerbose(void) { return false; }
 #endif
 
 static struct Nuitka_MetaPathBasedLoaderEntry *loader_entries = NULL;
+static Py_ssize_t loader_entries_count = 0;
 
 static bool hasFrozenModule(char const *name) {
     for (struct _frozen const *p = PyImport_FrozenModules;; p++) {
@@ -252,30 +253,64 @@ static PyObject *loadModuleFromCodeObject(PyObject *module, PyCodeObject *code_o
     return module;
 }
 
-static struct Nuitka_MetaPathBasedLoaderEntry *findEntry(char const *name) {
-    struct Nuitka_MetaPathBasedLoaderEntry *current = loader_entries;
-    assert(current);
+static char const *getEntryName(struct Nuitka_MetaPathBasedLoaderEntry *entry) {
+    if ((entry->flags & NUITKA_TRANSLATED_FLAG) != 0) {
+        entry->name = UNTRANSLATE(entry->name);
+        entry->flags -= NUITKA_TRANSLATED_FLAG;
+    }
 
-    while (current->name != NULL) {
-        if ((current->flags & NUITKA_TRANSLATED_FLAG) != 0) {
-            current->name = UNTRANSLATE(current->name);
-            current->flags -= NUITKA_TRANSLATED_FLAG;
-        }
+    return entry->name;
+}
 
-        if (strcmp(name, current->name) == 0) {
-            return current;
+// Compare the first "length" characters of "name" as a string of its own
+// with the entry name, with the same order as "strcmp".
+static int compareEntryName(char const *name, size_t length, struct Nuitka_MetaPathBasedLoaderEntry *entry) {
+    char const *entry_name = getEntryName(entry);
+
+    int res = strncmp(name, entry_name, length);
+
+    if (res == 0 && entry_name[length] != 0) {
+        res = -1;
+    }
+
+    return res;
+}
+
+// The entries are sorted by name at compile time, giving the index of the
+// first entry not sorting before the given name.
+static Py_ssize_t findEntryIndexLowerBound(char const *name, size_t length) {
+    Py_ssize_t low = 0;
+    Py_ssize_t high = loader_entries_count;
+
+    while (low < high) {
+        Py_ssize_t middle = low + (high - low) / 2;
+
+        if (compareEntryName(name, length, &loader_entries[middle]) > 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
         }
+    }
 
-        current++;
+    return low;
+}
+
+static struct Nuitka_MetaPathBasedLoaderEntry *findEntryN(char const *name, size_t length) {
+    assert(loader_entries);
+
+    Py_ssize_t index = findEntryIndexLowerBound(name, length);
+
+    if (index < loader_entries_count && compareEntryName(name, length, &loader_entries[index]) == 0) {
+        return &loader_entries[index];
     }
 
     return NULL;
 }
 
+static struct Nuitka_MetaPathBasedLoaderEntry *findEntry(char const *name) { return findEntryN(name, strlen(name)); }
+
 #ifndef _NUITKA_STANDALONE
 static struct Nuitka_MetaPathBasedLoaderEntry *findContainingPackageEntry(char const *name) {
-    struct Nuitka_MetaPathBasedLoaderEntry *current = loader_entries;
-
     // Consider the package name of the searched entry.
     char const *package_name_end = strrchr(name, '.');
     if (package_name_end == NULL) {
@@ -284,16 +319,13 @@ static struct Nuitka_MetaPathBasedLoaderEntry *findContainingPackageEntry(char c
 
     size_t length = package_name_end - name;
 
-    while (current->name != NULL) {
-        if ((current->flags & NUITKA_TRANSLATED_FLAG) != 0) {
-            current->name = UNTRANSLATE(current->name);
-            current->flags -= NUITKA_TRANSLATED_FLAG;
-        }
+    struct Nuitka_MetaPathBasedLoaderEntry *current = findEntryN(name, length);
 
+    // Entries of the same name are next to each other, one of them needs to be a package.
+    while (current != NULL && current < loader_entries + loader_entries_count &&
+           compareEntryName(name, length, current) == 0) {
         if ((current->flags & NUITKA_PACKAGE_FLAG) != 0) {
-            if (strlen(current->name) == length && strncmp(name, current->name, length) == 0) {
-                return current;
-            }
+            return current;
         }
 
         current++;
@@ -320,6 +352,73 @@ static PyObject *_getFileList(PyThreadState *tstate, PyObject *dirname) {
     return result;
 }
 
+static PyObject *_getDirectoryModificationTime(PyThreadState *tstate, PyObject *dirname) {
+    static PyObject *stat_func = NULL;
+
+    if (stat_func == NULL) {
+        stat_func = PyObject_GetAttrString(IMPORT_HARD_OS(), "stat");
+    }
+
+    if (unlikely(stat_func == NULL)) {
+        return NULL;
+    }
+
+    PyObject *stat_result = CALL_FUNCTION_WITH_SINGLE_ARG(tstate, stat_func, dirname);
+
+    if (unlikely(stat_result == NULL)) {
+        return NULL;
+    }
+
+    PyObject *result = PyObject_GetAttrString(stat_result, "st_mtime");
+    Py_DECREF(stat_result);
+
+    return result;
+}
+
+// Listings of package directories, kept together with the modification time
+// of the directory, so that import misses need not list them every time. The
+// "importlib.invalidate_caches" function also clears it.
+static PyObject *directory_listing_cache = NULL;
+
+static PyObject *_getCachedFileList(PyThreadState *tstate, PyObject *dirname) {
+    PyObject *mtime = _getDirectoryModificationTime(tstate, dirname);
+
+    if (unlikely(mtime == NULL)) {
+        return NULL;
+    }
+
+    if (directory_listing_cache == NULL) {
+        directory_listing_cache = MAKE_DICT_EMPTY();
+    }
+
+    PyObject *cache_entry = DICT_GET_ITEM0(tstate, directory_listing_cache, dirname);
+
+    if (cache_entry != NULL &&
+        RICH_COMPARE_EQ_NBOOL_OBJECT_OBJECT(PyTuple_GET_ITEM(cache_entry, 0), mtime) == NUITKA_BOOL_TRUE) {
+        Py_DECREF(mtime);
+
+        PyObject *result = PyTuple_GET_ITEM(cache_entry, 1);
+        Py_INCREF(result);
+
+        return result;
+    }
+
+    PyObject *result = _getFileList(tstate, dirname);
+
+    if (unlikely(result == NULL)) {
+        Py_DECREF(mtime);
+        return NULL;
+    }
+
+    cache_entry = PyTuple_Pack(2, mtime, result);
+    Py_DECREF(mtime);
+
+    DICT_SET_ITEM(directory_listing_cache, dirname, cache_entry);
+    Py_DECREF(cache_entry);
+
+    return result;
+}
+
 #if PYTHON_VERSION < 0x300
 static PyObject *_getImportingSuffixesByPriority(PyThreadState *tstate, int kind) {
     static PyObject *result = NULL;
@@ -393,7 +492,7 @@ static bool scanModuleInPackagePath(PyThreadState *tstate, PyObject *module_name
     for (Py_ssize_t i = 0; i < parent_path_size; i += 1) {
         PyObject *path_element = PyList_GET_ITEM(parent_path, i);
 
-        PyObject *filenames_list = _getFileList(tstate, path_element);
+        PyObject *filenames_list = _getCachedFileList(tstate, path_element);
 
         if (filenames_list == NULL) {
             CLEAR_ERROR_OCCURRED(tstate);
@@ -414,6 +513,8 @@ static bool scanModuleInPackagePath(PyThreadState *tstate, PyObject *module_name
                 }
             }
         }
+
+        Py_DECREF(filenames_list);
     }
 
 #if 0
@@ -1227,8 +1328,7 @@ static PyObject *_nuitka_loader_iter_modules(struct Nuitka_LoaderObject *self, P
 
     PyObject *result = MAKE_LIST_EMPTY(0);
 
-    struct Nuitka_MetaPathBasedLoaderEntry *current = loader_entries;
-    assert(current);
+    assert(loader_entries);
 
     char const *s;
 
@@ -1238,56 +1338,63 @@ static PyObject *_nuitka_loader_iter_modules(struct Nuitka_LoaderObject *self, P
         s = "";
     }
 
-    while (current->name != NULL) {
-        if ((current->flags & NUITKA_TRANSLATED_FLAG) != 0) {
-            current->name = UNTRANSLATE(current->name);
-            current->flags -= NUITKA_TRANSLATED_FLAG;
-        }
+    size_t s_length = strlen(s);
+
+    // The children of a package are all sorted after it and next to each
+    // other, so only that range needs to be looked at.
+    struct Nuitka_MetaPathBasedLoaderEntry *current = loader_entries;
+    struct Nuitka_MetaPathBasedLoaderEntry *end = loader_entries + loader_entries_count;
 
-        int c = strncmp(s, current->name, strlen(s));
+    if (s_length > 0) {
+        current = findEntryN(s, s_length);
 
-        if (c != 0) {
-            current++;
-            continue;
+        if (current == NULL) {
+            return result;
         }
+    }
 
-        if (strcmp(current->name, "__main__") == 0) {
-            current++;
-            continue;
+    for (; current < end; current++) {
+        char const *name = getEntryName(current);
+
+        if (strncmp(s, name, s_length) != 0) {
+            break;
         }
 
-        if (current->name[strlen(s)] == 0) {
-            current++;
+        if (strcmp(name, "__main__") == 0) {
             continue;
         }
 
-        char const *sub = strchr(current->name + strlen(s) + 1, '.');
+        char const *child_name;
 
-        if (sub != NULL) {
-            current++;
-            continue;
-        }
+        if (s_length > 0) {
+            // Other entries, e.g. "a.bc" for "a.b" are sorted in between too.
+            if (name[s_length] != '.') {
+                continue;
+            }
 
-        PyObject *name;
-        if (self->m_loader_entry) {
-            name = Nuitka_String_FromString(current->name + strlen(s) + 1);
+            child_name = name + s_length + 1;
         } else {
-            name = Nuitka_String_FromString(current->name);
+            child_name = name;
         }
 
+        // Only direct children are listed.
+        if (*child_name == 0 || strchr(child_name + 1, '.') != NULL) {
+            continue;
+        }
+
+        PyObject *name_object = Nuitka_String_FromString(child_name);
+
         if (CHECK_IF_TRUE(prefix)) {
-            PyObject *old = name;
-            name = PyUnicode_Concat(prefix, name);
+            PyObject *old = name_object;
+            name_object = PyUnicode_Concat(prefix, name_object);
             Py_DECREF(old);
         }
 
         PyObject *r = MAKE_TUPLE_EMPTY(2);
-        PyTuple_SET_ITEM(r, 0, name);
+        PyTuple_SET_ITEM(r, 0, name_object);
         PyTuple_SET_ITEM0(r, 1, BOOL_FROM((current->flags & NUITKA_PACKAGE_FLAG) != 0));
 
         LIST_APPEND1(result, r);
-
-        current++;
     }
 
     return result;
@@ -1727,10 +1834,7 @@ static PyObject *_nuitka_loader_sys_path_hook(PyObject *self, PyObject *args, Py
     PyThreadState *tstate = PyThreadState_GET();
 
     while (entry->name != NULL) {
-        if ((entry->flags & NUITKA_TRANSLATED_FLAG) != 0) {
-            entry->name = UNTRANSLATE(entry->name);
-            entry->flags -= NUITKA_TRANSLATED_FLAG;
-        }
+        getEntryName(entry);
 
         if ((entry->flags & NUITKA_PACKAGE_FLAG) != 0) {
             PyObject *module_directory = getModuleDirectory(tstate, entry);
@@ -1761,6 +1865,17 @@ static PyObject *_nuitka_loader_sys_path_hook(PyObject *self, PyObject *args, Py
     return NULL;
 }
 
+#ifndef _NUITKA_STANDALONE
+static PyObject *_nuitka_loader_invalidate_caches(PyObject *self, PyObject *unused) {
+    if (directory_listing_cache != NULL) {
+        PyDict_Clear(directory_listing_cache);
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+#endif
+
 static PyMethodDef Nuitka_Loader_methods[] = {
     {"iter_modules", (PyCFunction)_nuitka_loader_iter_modules, METH_VARARGS | METH_KEYWORDS, NULL},
     {"get_data", (PyCFunction)_nuitka_loader_get_data, METH_STATIC | METH_VARARGS | METH_KEYWORDS, NULL},
@@ -1785,6 +1900,10 @@ static PyMethodDef Nuitka_Loader_methods[] = {
 
     {"sys_path_hook", (PyCFunction)_nuitka_loader_sys_path_hook, METH_STATIC | METH_VARARGS | METH_KEYWORDS, NULL},
 
+#ifndef _NUITKA_STANDALONE
+    {"invalidate_caches", (PyCFunction)_nuitka_loader_invalidate_caches, METH_STATIC | METH_NOARGS, NULL},
+#endif
+
     {NULL, NULL}
 };
 
@@ -1803,9 +1922,10 @@ static PyObject *Nuitka_Loader_tp_repr(struct Nuitka_LoaderObject *loader) {
 // no big harm too, but make it small, maybe be allowing a toggle that makes a specific macro not
 // use the free list mechanism at all.
 
+#ifndef MAX_LOADER_FREE_LIST_COUNT
 #define MAX_LOADER_FREE_LIST_COUNT 10
-static struct Nuitka_LoaderObject *free_list_loaders = NULL;
-static int free_list_loaders_count = 0;
+#endif
+NUITKA_DECLARE_FREELIST(free_list_loaders, struct Nuitka_LoaderObject);
 
 static void Nuitka_Loader_tp_dealloc(struct Nuitka_LoaderObject *loader) {
     Nuitka_GC_UnTrack(loader);
@@ -1869,6 +1989,13 @@ PyObject *Nuitka_Loader_New(struct Nuitka_MetaPathBasedLoaderEntry const *entry)
     return (PyObject *)result;
 }
 
+#ifdef _NUITKA_MODULE
+static int compareEntries(void const *a, void const *b) {
+    return strcmp(((struct Nuitka_MetaPathBasedLoaderEntry const *)a)->name,
+                  ((struct Nuitka_MetaPathBasedLoaderEntry const *)b)->name);
+}
+#endif
+
 void registerMetaPathBasedUnfreezer(struct Nuitka_MetaPathBasedLoaderEntry *_loader_entries,
                                     unsigned char **bytecode_data) {
     // Do it only once.
@@ -1893,10 +2020,7 @@ void registerMetaPathBasedUnfreezer(struct Nuitka_MetaPathBasedLoaderEntry *_loa
             assert(current);
 
             while (current->name != NULL) {
-                if ((current->flags & NUITKA_TRANSLATED_FLAG) != 0) {
-                    current->name = UNTRANSLATE(current->name);
-                    current->flags -= NUITKA_TRANSLATED_FLAG;
-                }
+                getEntryName(current);
 
                 char name[2048];
 
@@ -1915,12 +2039,20 @@ void registerMetaPathBasedUnfreezer(struct Nuitka_MetaPathBasedLoaderEntry *_loa
 
                 current++;
             }
+
+            // Renaming can change the order, but the lookups rely on it.
+            qsort(_loader_entries, current - _loader_entries, sizeof(struct Nuitka_MetaPathBasedLoaderEntry),
+                  compareEntries);
         }
     }
 #endif
 
     loader_entries = _loader_entries;
 
+    while (loader_entries[loader_entries_count].name != NULL) {
+        loader_entries_count += 1;
+    }
+
     Nuitka_PyType_Ready(&Nuitka_Loader_Type, NULL, true, false, false, false, false);
 
 #ifdef _NUITKA_EXE
@@ -141,7 +141,8 @@ static void fatalErrorAttachedData(void) { fatalError("Error, couldn't decode at
 static void fatalErrorHeaderAttachedData(void) { fatalError("Error, could find attached data header."); }
 
 // Out of memory error.
-#if !defined(_WIN32) || _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+#if (!defined(_WIN32) && _NUITKA_ONEFILE_TEMP_BOOL == 1) || _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 || \
+    _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
 static void fatalErrorMemory(void) { fatalError("Error, couldn't allocate memory."); }
 #endif
 
@@ -261,11 +262,35 @@ static void closePayloadData(void) { unmapFileFromMemory(&exe_file_mapped); }
 
 #endif
 
-#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+// In compressed stream mode, groups of files are compressed as independent
+// frames, and multiple threads decompress them, each with its own reader state.
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
+#if defined(_MSC_VER)
+#define ONEFILE_READER_THREAD_LOCAL __declspec(thread)
+#else
+#define ONEFILE_READER_THREAD_LOCAL __thread
+#endif
+#else
+#define ONEFILE_READER_THREAD_LOCAL
+#endif
+
+// Archive entries and compressed stream groups are unpacked by a pool of
+// worker threads.
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1 || _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+#define _NUITKA_ONEFILE_PARALLEL_UNPACK_BOOL 1
+#else
+#define _NUITKA_ONEFILE_PARALLEL_UNPACK_BOOL 0
+#endif
+
+#if _NUITKA_ONEFILE_PARALLEL_UNPACK_BOOL == 1 && !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
 
-static ZSTD_DCtx *dest_ctx = NULL;
-static ZSTD_inBuffer input = {NULL, 0, 0};
-static ZSTD_outBuffer output = {NULL, 0, 0};
+static ONEFILE_READER_THREAD_LOCAL ZSTD_DCtx *dest_ctx = NULL;
+static ONEFILE_READER_THREAD_LOCAL ZSTD_inBuffer input = {NULL, 0, 0};
+static ONEFILE_READER_THREAD_LOCAL ZSTD_outBuffer output = {NULL, 0, 0};
 
 static void initZSTD(void) {
     input.src = NULL;
@@ -382,7 +407,7 @@ static unsigned long long readPayloadSizeValue(void) {
 
 #if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1 && _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
 static unsigned long long readArchiveFileSizeValue(void) {
-    unsigned long long result;
+    unsigned int result;
     readPayloadChunk(&result, sizeof(unsigned int));
 
     return result;
@@ -398,7 +423,7 @@ static filename_char_t readPayloadFilenameCharacter(void) {
 }
 
 static filename_char_t *readPayloadFilename(void) {
-    static filename_char_t buffer[1024];
+    static ONEFILE_READER_THREAD_LOCAL filename_char_t buffer[1024];
 
     filename_char_t *w = buffer;
 
@@ -415,73 +440,242 @@ static filename_char_t *readPayloadFilename(void) {
     return buffer;
 }
 
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
 static void writeContainedFile(FILE_HANDLE target_file, unsigned long long file_size) {
+    while (file_size > 0) {
+        static ONEFILE_READER_THREAD_LOCAL char chunk[32768];
+
+        long chunk_size;
+
+        // Doing min manually, as otherwise the compiler is confused from types.
+        if (file_size <= sizeof(chunk)) {
+            chunk_size = (long)file_size;
+        } else {
+            chunk_size = sizeof(chunk);
+        }
+
+        readPayloadChunk(chunk, chunk_size);
+
+        if (target_file != FILE_HANDLE_NULL) {
+            if (writeFileChunk(target_file, chunk, chunk_size) == false) {
+                fatalErrorTempFiles();
+            }
+        }
+
+        file_size -= chunk_size;
+    }
+
+    assert(file_size == 0);
+}
+#endif
+
+#if !defined(_WIN32) && !defined(__MSYS__)
+static void setFileExecutable(FILE_HANDLE target_file) {
+    int fd = fileno(target_file);
+
+    struct stat stat_buffer;
+    int res = fstat(fd, &stat_buffer);
+
+    if (res == -1) {
+        printOSErrorMessage("fstat", errno);
+    }
+
+    // User shall be able to execute if at least.
+    stat_buffer.st_mode |= S_IXUSR;
+
+    // Follow read flags for group, others according to umask.
+    if ((stat_buffer.st_mode & S_IRGRP) != 0) {
+        stat_buffer.st_mode |= S_IXOTH;
+    }
+
+    if ((stat_buffer.st_mode & S_IRGRP) != 0) {
+        stat_buffer.st_mode |= S_IXOTH;
+    }
+
+    res = fchmod(fd, stat_buffer.st_mode);
+
+    if (res == -1) {
+        printOSErrorMessage("fchmod", errno);
+    }
+}
+#endif
+
 #if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
+// In archive mode, every file is stored on its own, and compressed as an
+// independent frame, so they can be unpacked by multiple threads. The main
+// thread collects the entries, creating directories and links, and then the
+// file contents get written by a pool of workers.
 
-#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 0
-    if (target_file != FILE_HANDLE_NULL) {
-        if (writeFileChunk(target_file, payload_current, file_size) == false) {
-            fatalErrorTempFiles();
+struct OnefileArchiveEntry {
+    filename_char_t *target_path;
+
+    // Stored data inside the payload, compressed or not.
+    unsigned char const *data;
+    unsigned long long data_size;
+
+    unsigned long long file_size;
+
+#if !defined(_WIN32) && !defined(__MSYS__)
+    unsigned char file_flags;
+#endif
+
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+    uint32_t checksum;
+#endif
+};
+
+static struct OnefileArchiveEntry *archive_entries = NULL;
+static size_t archive_entries_count = 0;
+static size_t archive_entries_allocated = 0;
+
+static struct OnefileArchiveEntry *addArchiveEntry(filename_char_t const *target_path) {
+    if (archive_entries_count == archive_entries_allocated) {
+        archive_entries_allocated = archive_entries_allocated == 0 ? 256 : archive_entries_allocated * 2;
+
+        archive_entries = (struct OnefileArchiveEntry *)realloc(
+            archive_entries, archive_entries_allocated * sizeof(struct OnefileArchiveEntry));
+
+        if (archive_entries == NULL) {
+            fatalErrorMemory();
         }
     }
 
-    payload_current += file_size;
-#else
-    if (target_file != FILE_HANDLE_NULL) {
+    struct OnefileArchiveEntry *entry = &archive_entries[archive_entries_count];
+    archive_entries_count += 1;
 
-        // Nothing available, make sure to make it available from existing input.
-        while (input.pos < input.size) {
-            // printf("available input %ld %ld\n", input.pos, input.size);
+    entry->target_path = strdupFilename(target_path);
 
-            output.pos = 0;
-            output.size = ZSTD_DStreamOutSize();
+    if (entry->target_path == NULL) {
+        fatalErrorMemory();
+    }
 
-            size_t const ret = ZSTD_decompressStream(dest_ctx, &output, &input);
-            if (ZSTD_isError(ret)) {
-                fatalErrorAttachedData();
-            }
+    return entry;
+}
 
-            // printf("available output %ld %ld\n", output.pos, output.size);
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 0 && defined(__linux__)
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+
+// Uncompressed entries are copied straight from the executable file by the
+// kernel, without passing through our memory. With "copy_file_range" on a
+// file system with reflinks, the data blocks are even shared rather than
+// written. Returns the amount copied, the rest is up to the caller.
+static unsigned long long copyArchiveEntryFromExecutable(FILE_HANDLE target_file,
+                                                         struct OnefileArchiveEntry const *entry) {
+    int output_fd = fileno(target_file);
+    loff_t offset = (loff_t)(entry->data - exe_file_mapped.data);
+    unsigned long long copied = 0;
+
+#ifdef __NR_copy_file_range
+    // Called directly, older C libraries lack the wrapper.
+    while (copied < entry->file_size) {
+        long res = syscall(__NR_copy_file_range, exe_file_mapped.file_handle, &offset, output_fd, NULL,
+                           (size_t)(entry->file_size - copied), 0);
+
+        if (res <= 0) {
+            break;
+        }
 
-            if (writeFileChunk(target_file, (char const *)output.dst, output.pos) == false) {
-                fatalErrorTempFiles();
-            }
+        copied += res;
+    }
+#endif
+
+    // Not supported by kernel or between these file systems, "sendfile"
+    // still avoids the copy through user space.
+    while (copied < entry->file_size) {
+        off_t sendfile_offset = (off_t)offset;
+
+        ssize_t res = sendfile(output_fd, exe_file_mapped.file_handle, &sendfile_offset,
+                               (size_t)(entry->file_size - copied));
 
-            // printf("made output %ld %lld\n", output.pos, file_size);
-            file_size -= output.pos;
-            assert(file_size >= 0);
+        if (res <= 0) {
+            break;
         }
 
-        assert(file_size == 0);
+        offset = (loff_t)sendfile_offset;
+        copied += res;
     }
+
+    return copied;
+}
 #endif
-#else
-    while (file_size > 0) {
-        static char chunk[32768];
 
-        long chunk_size;
+static void unpackArchiveEntry(struct OnefileArchiveEntry const *entry
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+                               ,
+                               ZSTD_DCtx *dctx, void *buffer, size_t buffer_size
+#endif
+) {
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+    if (getFileCRC32(entry->target_path) == entry->checksum) {
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+        fprintf(stderr, "CACHE HIT for '" FILENAME_FORMAT_STR "'.\n", entry->target_path);
+#endif
+        return;
+    }
 
-        // Doing min manually, as otherwise the compiler is confused from types.
-        if (file_size <= sizeof(chunk)) {
-            chunk_size = (long)file_size;
-        } else {
-            chunk_size = sizeof(chunk);
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+    fprintf(stderr, "CACHE MISS for '" FILENAME_FORMAT_STR "'.\n", entry->target_path);
+#endif
+#endif
+
+    FILE_HANDLE target_file = createFileForWritingChecked(entry->target_path);
+
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+    ZSTD_inBuffer input = {entry->data, (size_t)entry->data_size, 0};
+    unsigned long long file_size = entry->file_size;
+
+    for (;;) {
+        ZSTD_outBuffer output = {buffer, buffer_size, 0};
+
+        size_t const ret = ZSTD_decompressStream(dctx, &output, &input);
+        if (ZSTD_isError(ret)) {
+            fatalErrorAttachedData();
         }
 
-        readPayloadChunk(chunk, chunk_size);
+        if (writeFileChunk(target_file, buffer, output.pos) == false) {
+            fatalErrorTempFiles();
+        }
 
-        if (target_file != FILE_HANDLE_NULL) {
-            if (writeFileChunk(target_file, chunk, chunk_size) == false) {
-                fatalErrorTempFiles();
-            }
+        file_size -= output.pos;
+
+        // Frame is completely decoded and flushed.
+        if (ret == 0) {
+            break;
         }
 
-        file_size -= chunk_size;
+        // Truncated input, cannot make progress anymore.
+        if (input.pos == input.size && output.pos < output.size) {
+            fatalErrorAttachedData();
+        }
     }
 
-    assert(file_size == 0);
+    if (file_size != 0) {
+        fatalErrorAttachedData();
+    }
+#else
+    unsigned long long copied = 0;
+
+#if defined(__linux__)
+    copied = copyArchiveEntryFromExecutable(target_file, entry);
+#endif
+
+    if (writeFileChunk(target_file, entry->data + copied, entry->file_size - copied) == false) {
+        fatalErrorTempFiles();
+    }
+#endif
+
+#if !defined(_WIN32) && !defined(__MSYS__)
+    if (entry->file_flags & 1) {
+        setFileExecutable(target_file);
+    }
 #endif
+
+    if (closeFile(target_file) == false) {
+        fatalErrorTempFiles();
+    }
 }
+#endif
 
 // Zero means, not yet created, created unsuccessfully, terminated already.
 #if defined(_WIN32)
@@ -496,11 +690,62 @@ static filename_char_t payload_path[4096] = {0};
 static bool payload_created = false;
 #endif
 
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+// After a complete unpacking, the hash of the payload is stored in this file,
+// so the next start can see from it alone that nothing needs to be done.
+static filename_char_t payload_stamp_path[4096] = {0};
+
+static void initPayloadStampPath(void) {
+    appendStringSafeFilename(payload_stamp_path, payload_path, sizeof(payload_stamp_path) / sizeof(filename_char_t));
+    appendCharSafeFilename(payload_stamp_path, FILENAME_SEP_CHAR, sizeof(payload_stamp_path) / sizeof(filename_char_t));
+    appendStringSafeFilename(payload_stamp_path, FILENAME_EMPTY_STR ".nuitka-onefile-stamp",
+                             sizeof(payload_stamp_path) / sizeof(filename_char_t));
+}
+
+static bool checkPayloadStamp(uint32_t payload_hash) {
+    FILE_HANDLE stamp_file = openFileForReading(payload_stamp_path);
+
+    if (stamp_file == FILE_HANDLE_NULL) {
+        return false;
+    }
+
+    uint32_t stamp_hash = 0;
+    bool result = readFileChunk(stamp_file, &stamp_hash, sizeof(stamp_hash)) && stamp_hash == payload_hash;
+
+    closeFile(stamp_file);
+
+    return result;
+}
+
+static void writePayloadStamp(uint32_t payload_hash) {
+    static filename_char_t stamp_temp_path[4096] = {0};
+
+    appendStringSafeFilename(stamp_temp_path, payload_stamp_path, sizeof(stamp_temp_path) / sizeof(filename_char_t));
+    appendStringSafeFilename(stamp_temp_path, FILENAME_EMPTY_STR ".tmp",
+                             sizeof(stamp_temp_path) / sizeof(filename_char_t));
+
+    FILE_HANDLE stamp_file = createFileForWriting(stamp_temp_path);
+
+    // Not being able to write the stamp only costs the checks on next start.
+    if (stamp_file == FILE_HANDLE_NULL) {
+        return;
+    }
+
+    bool bool_res = writeFileChunk(stamp_file, &payload_hash, sizeof(payload_hash));
+    bool_res = closeFile(stamp_file) && bool_res;
+
+    // Renaming makes sure, a stamp is either complete or not there at all.
+    if (bool_res == false || renameFile(stamp_temp_path, payload_stamp_path) == false) {
+        deleteFile(stamp_temp_path);
+    }
+}
+#endif
+
 #define MAX_CREATED_DIRS 1024
 static filename_char_t *created_dir_paths[MAX_CREATED_DIRS];
 int created_dir_count = 0;
 
-static bool createDirectory(filename_char_t const *path) {
+static bool _createDirectory(filename_char_t const *path) {
     bool bool_res;
 
 #if defined(_WIN32)
@@ -554,6 +799,38 @@ static bool createDirectory(filename_char_t const *path) {
     return bool_res;
 }
 
+// Workers of compressed stream groups create directories concurrently, and
+// share the cache of created ones.
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
+#if defined(_WIN32)
+static SRWLOCK created_dir_lock = SRWLOCK_INIT;
+#else
+static pthread_mutex_t created_dir_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+#endif
+
+static bool createDirectory(filename_char_t const *path) {
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&created_dir_lock);
+#else
+    pthread_mutex_lock(&created_dir_lock);
+#endif
+#endif
+
+    bool bool_res = _createDirectory(path);
+
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&created_dir_lock);
+#else
+    pthread_mutex_unlock(&created_dir_lock);
+#endif
+#endif
+
+    return bool_res;
+}
+
 static bool createContainingDirectory(filename_char_t const *path) {
     filename_char_t dir_path[4096] = {0};
     dir_path[0] = 0;
@@ -581,6 +858,343 @@ static bool createContainingDirectory(filename_char_t const *path) {
     return true;
 }
 
+// Unpack the entries of the payload up to the empty filename ending them. The
+// first one is the binary to launch, which is remembered in "first_filename"
+// if given, and with "first_only", it's the only one read.
+static void unpackPayloadEntries(filename_char_t *first_filename, size_t first_filename_size, bool first_only) {
+    for (;;) {
+        filename_char_t *filename = readPayloadFilename();
+
+        // printf("Filename: " FILENAME_FORMAT_STR "\n", filename);
+
+        // Detect EOF from empty filename.
+        if (filename[0] == 0) {
+            break;
+        }
+
+        filename_char_t target_path[4096] = {0};
+
+        appendStringSafeFilename(target_path, payload_path, sizeof(target_path) / sizeof(filename_char_t));
+        appendCharSafeFilename(target_path, FILENAME_SEP_CHAR, sizeof(target_path) / sizeof(filename_char_t));
+        appendStringSafeFilename(target_path, filename, sizeof(target_path) / sizeof(filename_char_t));
+
+        if (first_filename != NULL && first_filename[0] == 0) {
+            appendStringSafeFilename(first_filename, target_path, first_filename_size);
+
+            if (first_only) {
+                break;
+            }
+        }
+
+#if !defined(_WIN32) && !defined(__MSYS__)
+        unsigned char file_flags = readPayloadFileFlagsValue();
+#endif
+
+#if !defined(_WIN32) && !defined(__MSYS__)
+        if (file_flags & 2) {
+            filename_char_t *link_target_path = readPayloadFilename();
+
+            // printf("Filename: " FILENAME_FORMAT_STR " symlink to " FILENAME_FORMAT_STR "\n", target_path,
+            // link_target_path);
+
+            createContainingDirectory(target_path);
+
+            unlink(target_path);
+            if (symlink(link_target_path, target_path) != 0) {
+                fatalErrorTempFileCreate(target_path);
+            }
+
+            continue;
+        }
+#endif
+        // _putws(target_path);
+        unsigned long long file_size = readPayloadSizeValue();
+
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
+        struct OnefileArchiveEntry *entry = addArchiveEntry(target_path);
+
+        entry->file_size = file_size;
+#if !defined(_WIN32) && !defined(__MSYS__)
+        entry->file_flags = file_flags;
+#endif
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+        entry->checksum = readPayloadChecksumValue();
+#endif
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+        entry->data_size = readArchiveFileSizeValue();
+#else
+        entry->data_size = file_size;
+#endif
+        entry->data = payload_current;
+        payload_current += entry->data_size;
+
+        // Directories are created here, such that the workers need not
+        // coordinate about it.
+        createContainingDirectory(target_path);
+#else
+        bool needs_write = true;
+
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+        uint32_t contained_file_checksum = readPayloadChecksumValue();
+        uint32_t existing_file_checksum = getFileCRC32(target_path);
+
+        if (contained_file_checksum == existing_file_checksum) {
+            needs_write = false;
+
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+            fprintf(stderr, "CACHE HIT for '" FILENAME_FORMAT_STR "'.\n", target_path);
+#endif
+        } else {
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+            fprintf(stderr, "CACHE MISS for '" FILENAME_FORMAT_STR "'.\n", target_path);
+#endif
+        }
+#endif
+
+        FILE_HANDLE target_file = FILE_HANDLE_NULL;
+
+        if (needs_write) {
+            createContainingDirectory(target_path);
+            target_file = createFileForWritingChecked(target_path);
+        }
+
+        writeContainedFile(target_file, file_size);
+
+#if !defined(_WIN32) && !defined(__MSYS__)
+        if ((file_flags & 1) && (target_file != FILE_HANDLE_NULL)) {
+            setFileExecutable(target_file);
+        }
+#endif
+
+        if (target_file != FILE_HANDLE_NULL) {
+            if (closeFile(target_file) == false) {
+                fatalErrorTempFiles();
+            }
+        }
+#endif
+    }
+}
+
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
+// The compressed stream is a sequence of groups, each prefixed with the size
+// of its frame, and a zero size ends it. Every frame holds whole entries, so
+// a group can be unpacked on its own.
+struct OnefileStreamGroup {
+    unsigned char const *data;
+    size_t data_size;
+};
+
+static struct OnefileStreamGroup *stream_groups = NULL;
+static size_t stream_groups_count = 0;
+
+static void readStreamGroups(void) {
+    size_t stream_groups_allocated = 0;
+
+    for (;;) {
+        uint32_t data_size;
+        readChunk(&data_size, sizeof(data_size));
+
+        if (data_size == 0) {
+            break;
+        }
+
+        if (stream_groups_count == stream_groups_allocated) {
+            stream_groups_allocated = stream_groups_allocated == 0 ? 64 : stream_groups_allocated * 2;
+
+            stream_groups = (struct OnefileStreamGroup *)realloc(
+                stream_groups, stream_groups_allocated * sizeof(struct OnefileStreamGroup));
+
+            if (stream_groups == NULL) {
+                fatalErrorMemory();
+            }
+        }
+
+        stream_groups[stream_groups_count].data = payload_current;
+        stream_groups[stream_groups_count].data_size = data_size;
+        stream_groups_count += 1;
+
+        payload_current += data_size;
+    }
+
+    if (stream_groups_count == 0) {
+        fatalErrorAttachedData();
+    }
+}
+
+// Make the reader of the current thread continue with the given group.
+static void startStreamGroup(struct OnefileStreamGroup const *group) {
+    ZSTD_DCtx_reset(dest_ctx, ZSTD_reset_session_only);
+
+    input.src = group->data;
+    input.pos = 0;
+    input.size = group->data_size;
+
+    output.pos = 0;
+    output.size = 0;
+}
+#endif
+
+#if _NUITKA_ONEFILE_PARALLEL_UNPACK_BOOL == 1
+// Archive entries, or compressed stream groups, are units of work taken by
+// their index, from the main thread and a pool of additional workers.
+
+// More threads than this are not going to make the disk any faster.
+#define MAX_ONEFILE_UNPACK_THREADS 16
+
+static size_t unpack_work_count = 0;
+
+#if defined(_WIN32)
+static volatile LONG unpack_work_next = 0;
+
+static size_t takeUnpackWorkIndex(void) { return (size_t)(InterlockedIncrement(&unpack_work_next) - 1); }
+#else
+static size_t unpack_work_next = 0;
+
+static size_t takeUnpackWorkIndex(void) { return __sync_fetch_and_add(&unpack_work_next, 1); }
+#endif
+
+static void unpackWorkItems(void) {
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1 && _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+    size_t const buffer_size = ZSTD_DStreamOutSize();
+    void *buffer = malloc(buffer_size);
+    if (buffer == NULL) {
+        fatalErrorMemory();
+    }
+
+    ZSTD_DCtx *dctx = ZSTD_createDCtx();
+    if (dctx == NULL) {
+        fatalErrorMemory();
+    }
+#endif
+
+    for (;;) {
+        size_t index = takeUnpackWorkIndex();
+
+        if (index >= unpack_work_count) {
+            break;
+        }
+
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
+        unpackArchiveEntry(&archive_entries[index]
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+                           ,
+                           dctx, buffer, buffer_size
+#endif
+        );
+#else
+        startStreamGroup(&stream_groups[index]);
+        unpackPayloadEntries(NULL, 0, false);
+#endif
+    }
+
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1 && _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+    ZSTD_freeDCtx(dctx);
+    free(buffer);
+#endif
+}
+
+static void unpackWorkItemsInThread(void) {
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
+    initZSTD();
+#endif
+
+    unpackWorkItems();
+
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
+    releaseZSTD();
+#endif
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI unpackWorkItemsThread(LPVOID arg) {
+    unpackWorkItemsInThread();
+    return 0;
+}
+#else
+static void *unpackWorkItemsThread(void *arg) {
+    unpackWorkItemsInThread();
+    return NULL;
+}
+#endif
+
+static int getUnpackThreadCount(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    long cpu_count = (long)system_info.dwNumberOfProcessors;
+#else
+    long cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    if (cpu_count > MAX_ONEFILE_UNPACK_THREADS) {
+        cpu_count = MAX_ONEFILE_UNPACK_THREADS;
+    }
+
+    if ((size_t)cpu_count > unpack_work_count) {
+        cpu_count = (long)unpack_work_count;
+    }
+
+    return cpu_count < 1 ? 1 : (int)cpu_count;
+}
+
+#if defined(_WIN32)
+static HANDLE unpack_threads[MAX_ONEFILE_UNPACK_THREADS];
+#else
+static pthread_t unpack_threads[MAX_ONEFILE_UNPACK_THREADS];
+#endif
+static int unpack_threads_started = 0;
+
+static void startUnpackThreads(void) {
+    int thread_count = getUnpackThreadCount();
+
+    // The main thread is a worker too, start only the additional ones, and
+    // if that fails, the others will simply do more work.
+    for (int i = 1; i < thread_count; i++) {
+#if defined(_WIN32)
+        unpack_threads[unpack_threads_started] = CreateThread(NULL, 0, unpackWorkItemsThread, NULL, 0, NULL);
+
+        if (unpack_threads[unpack_threads_started] != NULL) {
+            unpack_threads_started += 1;
+        }
+#else
+        if (pthread_create(&unpack_threads[unpack_threads_started], NULL, unpackWorkItemsThread, NULL) == 0) {
+            unpack_threads_started += 1;
+        }
+#endif
+    }
+}
+
+static void finishUnpackThreads(void) {
+    unpackWorkItems();
+
+    for (int i = 0; i < unpack_threads_started; i++) {
+#if defined(_WIN32)
+        WaitForSingleObject(unpack_threads[i], INFINITE);
+        CloseHandle(unpack_threads[i]);
+#else
+        pthread_join(unpack_threads[i], NULL);
+#endif
+    }
+
+    unpack_threads_started = 0;
+
+#if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
+    for (size_t i = 0; i < archive_entries_count; i++) {
+        free(archive_entries[i].target_path);
+    }
+
+    free(archive_entries);
+    archive_entries = NULL;
+    archive_entries_count = 0;
+#else
+    free(stream_groups);
+    stream_groups = NULL;
+    stream_groups_count = 0;
+#endif
+}
+#endif
+
 #if _NUITKA_ONEFILE_TEMP_BOOL == 1
 #if defined(_WIN32)
 
@@ -921,157 +1535,93 @@ int main(int argc, char **argv) {
     if (header[2] != 'Y') {
         fatalErrorHeaderAttachedData();
     }
-    initZSTD();
-
-    input.src = payload_current;
-    input.pos = 0;
-    input.size = payload_size;
-
-    assert(payload_size > 0);
 #else
     if (header[2] != 'X') {
         fatalErrorHeaderAttachedData();
     }
 #endif
 
-    static filename_char_t first_filename[1024] = {0};
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+    // Hash of the whole payload, stored uncompressed after the header.
+    uint32_t payload_hash;
+    readChunk(&payload_hash, sizeof(payload_hash));
 
-#if _NUITKA_ONEFILE_SPLASH_SCREEN
-    NUITKA_PRINT_TIMING("ONEFILE: Splash screen.");
+    initPayloadStampPath();
 
-    initSplashScreen();
-#endif
+    bool payload_unpacked = checkPayloadStamp(payload_hash);
 
-    NUITKA_PRINT_TIMING("ONEFILE: Entering decompression.");
+    if (payload_unpacked == false) {
+        // Any unpacking from here on, may be incomplete until it's stamped again.
+        deleteFile(payload_stamp_path);
+    }
 
-#if _NUITKA_ONEFILE_TEMP_BOOL == 1
-    payload_created = true;
+#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
+    fprintf(stderr, "CACHE %s for payload stamp '" FILENAME_FORMAT_STR "'.\n", payload_unpacked ? "HIT" : "MISS",
+            payload_stamp_path);
+#endif
 #endif
 
-    for (;;) {
-        filename_char_t *filename = readPayloadFilename();
-
-        // printf("Filename: " FILENAME_FORMAT_STR "\n", filename);
-
-        // Detect EOF from empty filename.
-        if (filename[0] == 0) {
-            break;
-        }
-
-        static filename_char_t target_path[4096] = {0};
-        target_path[0] = 0;
-
-        appendStringSafeFilename(target_path, payload_path, sizeof(target_path) / sizeof(filename_char_t));
-        appendCharSafeFilename(target_path, FILENAME_SEP_CHAR, sizeof(target_path) / sizeof(filename_char_t));
-        appendStringSafeFilename(target_path, filename, sizeof(target_path) / sizeof(filename_char_t));
-
-        if (first_filename[0] == 0) {
-            appendStringSafeFilename(first_filename, target_path, sizeof(target_path) / sizeof(filename_char_t));
-        }
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
+    initZSTD();
 
-#if !defined(_WIN32) && !defined(__MSYS__)
-        unsigned char file_flags = readPayloadFileFlagsValue();
+    readStreamGroups();
+    startStreamGroup(&stream_groups[0]);
 #endif
 
-#if !defined(_WIN32) && !defined(__MSYS__)
-        if (file_flags & 2) {
-            filename_char_t *link_target_path = readPayloadFilename();
+    static filename_char_t first_filename[4096] = {0};
 
-            // printf("Filename: " FILENAME_FORMAT_STR " symlink to " FILENAME_FORMAT_STR "\n", target_path,
-            // link_target_path);
+#if _NUITKA_ONEFILE_SPLASH_SCREEN
+    NUITKA_PRINT_TIMING("ONEFILE: Splash screen.");
 
-            createContainingDirectory(target_path);
+    initSplashScreen();
+#endif
 
-            unlink(target_path);
-            if (symlink(link_target_path, target_path) != 0) {
-                fatalErrorTempFileCreate(target_path);
-            }
+    NUITKA_PRINT_TIMING("ONEFILE: Entering decompression.");
 
-            continue;
-        }
+#if _NUITKA_ONEFILE_TEMP_BOOL == 1
+    payload_created = true;
 #endif
-        // _putws(target_path);
-        unsigned long long file_size = readPayloadSizeValue();
 
-        bool needs_write = true;
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
+    unpack_work_count = stream_groups_count;
 
 #if _NUITKA_ONEFILE_TEMP_BOOL == 0
-        uint32_t contained_file_checksum = readPayloadChecksumValue();
-        uint32_t existing_file_checksum = getFileCRC32(target_path);
-
-        if (contained_file_checksum == existing_file_checksum) {
-            needs_write = false;
-
-#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
-            fprintf(stderr, "CACHE HIT for '" FILENAME_FORMAT_STR "'.\n", target_path);
+    // From a stamped payload, only the binary to launch is needed, and that
+    // is at the start of the first group.
+    if (payload_unpacked) {
+        unpack_work_count = 1;
+    }
 #endif
-        } else {
-#ifdef _NUITKA_EXPERIMENTAL_DEBUG_ONEFILE_CACHING
-            fprintf(stderr, "CACHE MISS for '" FILENAME_FORMAT_STR "'.\n", target_path);
+
+    // The first group is unpacked by the main thread, the other ones by the
+    // workers started right away.
+    takeUnpackWorkIndex();
+    startUnpackThreads();
 #endif
-        }
+
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+    // Only the binary to launch is needed from a stamped payload.
+    unpackPayloadEntries(first_filename, sizeof(first_filename) / sizeof(filename_char_t), payload_unpacked);
+#else
+    unpackPayloadEntries(first_filename, sizeof(first_filename) / sizeof(filename_char_t), false);
 #endif
 
 #if _NUITKA_ONEFILE_ARCHIVE_BOOL == 1
-#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
-        uint32_t contained_archive_file_size = readArchiveFileSizeValue();
-
-        input.src = payload_current;
-        input.pos = 0;
-        input.size = contained_archive_file_size;
+    NUITKA_PRINT_TIMING("ONEFILE: Unpacking archive entries in parallel.");
 
-        output.pos = 0;
-        output.size = 0;
-
-        payload_current += contained_archive_file_size;
-#endif
+    unpack_work_count = archive_entries_count;
+    startUnpackThreads();
 #endif
-        FILE_HANDLE target_file = FILE_HANDLE_NULL;
-
-        if (needs_write) {
-            createContainingDirectory(target_path);
-            target_file = createFileForWritingChecked(target_path);
-        }
-
-        writeContainedFile(target_file, file_size);
 
-#if !defined(_WIN32) && !defined(__MSYS__)
-        if ((file_flags & 1) && (target_file != FILE_HANDLE_NULL)) {
-            int fd = fileno(target_file);
-
-            struct stat stat_buffer;
-            int res = fstat(fd, &stat_buffer);
-
-            if (res == -1) {
-                printOSErrorMessage("fstat", errno);
-            }
-
-            // User shall be able to execute if at least.
-            stat_buffer.st_mode |= S_IXUSR;
-
-            // Follow read flags for group, others according to umask.
-            if ((stat_buffer.st_mode & S_IRGRP) != 0) {
-                stat_buffer.st_mode |= S_IXOTH;
-            }
-
-            if ((stat_buffer.st_mode & S_IRGRP) != 0) {
-                stat_buffer.st_mode |= S_IXOTH;
-            }
-
-            res = fchmod(fd, stat_buffer.st_mode);
-
-            if (res == -1) {
-                printOSErrorMessage("fchmod", errno);
-            }
-        }
+#if _NUITKA_ONEFILE_PARALLEL_UNPACK_BOOL == 1
+    finishUnpackThreads();
 #endif
 
-        if (target_file != FILE_HANDLE_NULL) {
-            if (closeFile(target_file) == false) {
-                fatalErrorTempFiles();
-            }
-        }
+#if _NUITKA_ONEFILE_TEMP_BOOL == 0
+    if (payload_unpacked == false) {
+        writePayloadStamp(payload_hash);
     }
+#endif
 
     NUITKA_PRINT_TIMING("ONEFILE: Finishing decompression, cleanup payload.");
 
@@ -1081,7 +1631,7 @@ int main(int argc, char **argv) {
     exe_file_updatable = true;
 #endif
 
-#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1
+#if _NUITKA_ONEFILE_COMPRESSION_BOOL == 1 && _NUITKA_ONEFILE_ARCHIVE_BOOL == 0
     releaseZSTD();
 #endif
 
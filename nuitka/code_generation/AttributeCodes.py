@@ -21,6 +21,7 @@ Attribute lookup, setting.
 """
 
 from nuitka import Options
+from nuitka.PythonVersions import python_version
 
 from .CodeHelpers import (
     decideConversionCheckNeeded,
@@ -112,6 +113,16 @@ def getAttributeLookupCode(
         emit("%s = LOOKUP_ATTRIBUTE_DICT_SLOT(tstate, %s);" % (to_name, source_name))
     elif attribute_name == "__class__":
         emit("%s = LOOKUP_ATTRIBUTE_CLASS_SLOT(tstate, %s);" % (to_name, source_name))
+    elif 0x300 <= python_version < 0x3B0:
+        # Each lookup site has its own cache for the type seen last.
+        emit(
+            """\
+{
+    static struct Nuitka_AttributeCache cache;
+    %s = LOOKUP_ATTRIBUTE_CACHED(tstate, %s, %s, &cache);
+}"""
+            % (to_name, source_name, context.getConstantCode(attribute_name))
+        )
     else:
         emit(
             "%s = LOOKUP_ATTRIBUTE(tstate, %s, %s);"
@@ -19,22 +19,79 @@
 
 """
 
+from nuitka.Options import shallCreatePgoInput
+from nuitka.pgo.PGO import getBranchOutcomesFromPGO
+
 from .CodeHelpers import generateStatementSequenceCode
 from .ConditionalCodes import generateConditionCode
 from .Emission import withSubCollector
 from .LabelCodes import getGotoCode, getLabelCode
 
 
+# Branches are only predicted, if the PGO run passed them often enough, and
+# the other outcome was seen in at most one percent of the cases.
+_pgo_branch_min_count = 100
+
+
+def _decideLikelyBranchTarget(branch_outcomes, true_target, false_target):
+    if branch_outcomes is None:
+        return None
+
+    taken, not_taken = branch_outcomes
+    total = taken + not_taken
+
+    if total < _pgo_branch_min_count:
+        return None
+
+    if not_taken * 100 <= total:
+        return true_target
+    elif taken * 100 <= total:
+        return false_target
+    else:
+        return None
+
+
 def generateBranchCode(statement, emit, context):
     true_target = context.allocateLabel("branch_yes")
     false_target = context.allocateLabel("branch_no")
     end_target = context.allocateLabel("branch_end")
 
+    line_number = statement.getSourceReference().getLineNumber()
+    pgo_probe_index = context.allocatePgoBranchProbeIndex(line_number)
+
+    if shallCreatePgoInput():
+        # The name is interned only once, and kept in a static variable.
+        pgo_probe_id = "pgo_probe_id_%d" % context.allocatePgoProbeSiteIndex()
+        emit("static uint32_t %s = 0;" % pgo_probe_id)
+
+        pgo_probe_code = 'PGO_onBranchPassed(PGO_PROBE_ID(%s, "%s:%d:%d"), %%s);' % (
+            pgo_probe_id,
+            context.getModuleName(),
+            line_number,
+            pgo_probe_index,
+        )
+
+        likely_target = None
+    else:
+        pgo_probe_code = None
+
+        likely_target = _decideLikelyBranchTarget(
+            branch_outcomes=getBranchOutcomesFromPGO(
+                module_name=context.getModuleName(),
+                line_number=line_number,
+                probe_index=pgo_probe_index,
+            ),
+            true_target=true_target,
+            false_target=false_target,
+        )
+
     old_true_target = context.getTrueBranchTarget()
     old_false_target = context.getFalseBranchTarget()
+    old_likely_target = context.getLikelyBranchTarget()
 
     context.setTrueBranchTarget(true_target)
     context.setFalseBranchTarget(false_target)
+    context.setLikelyBranchTarget(likely_target)
 
     # Have own declaration scope for condition, to limit visibility from branches
     # which can be huge.
@@ -45,19 +102,29 @@ def generateBranchCode(statement, emit, context):
 
     context.setTrueBranchTarget(old_true_target)
     context.setFalseBranchTarget(old_false_target)
+    context.setLikelyBranchTarget(old_likely_target)
 
     getLabelCode(true_target, emit)
 
+    if pgo_probe_code is not None:
+        emit(pgo_probe_code % "true")
+
     generateStatementSequenceCode(
         statement_sequence=statement.subnode_yes_branch, emit=emit, context=context
     )
 
-    if statement.subnode_no_branch is not None:
+    if statement.subnode_no_branch is not None or pgo_probe_code is not None:
         getGotoCode(end_target, emit)
         getLabelCode(false_target, emit)
 
+        if pgo_probe_code is not None:
+            emit(pgo_probe_code % "false")
+
         generateStatementSequenceCode(
-            statement_sequence=statement.subnode_no_branch, emit=emit, context=context
+            statement_sequence=statement.subnode_no_branch,
+            allow_none=True,
+            emit=emit,
+            context=context,
         )
 
         getLabelCode(end_target, emit)
@@ -24,6 +24,7 @@ able to execute them without creating the argument dictionary at all.
 """
 
 from nuitka.Constants import isMutable
+from nuitka.PythonVersions import python_version
 from nuitka.utils.Jinja2 import getTemplateC
 
 from .CodeHelpers import (
@@ -194,6 +195,41 @@ def _generateCallCodePosOnly(
             )
 
 
+def _canUseKeywordArgsCache(args_count, kw_size):
+    # The cache covers the argument counts that have static helpers and limits
+    # the keyword names to a fixed size.
+    return python_version >= 0x300 and args_count <= 10 and kw_size <= 8
+
+
+def _emitCallCodeKwSplitCached(
+    to_name, called_name, args_code, args_count, kw_values_code, kw_names, emit
+):
+    # Each call site has its own cache for the function code seen last.
+    emit(
+        """\
+{
+    static struct Nuitka_KeywordArgsCache cache;
+    %(to_name)s = CALL_FUNCTION_WITH_ARGS_KWSPLIT_CACHED(
+        tstate,
+        %(called_name)s,
+        %(args_code)s,
+        %(args_count)d,
+        %(kw_values_code)s,
+        %(kw_names)s,
+        &cache
+    );
+}"""
+        % {
+            "to_name": to_name,
+            "called_name": called_name,
+            "args_code": args_code,
+            "args_count": args_count,
+            "kw_values_code": kw_values_code,
+            "kw_names": kw_names,
+        }
+    )
+
+
 def _getCallCodeKwSplitFromConstant(
     to_name, expression, call_kw, called_name, called_attribute_name, emit, context
 ):
@@ -223,15 +259,26 @@ def _getCallCodeKwSplitFromConstant(
 
     emitLineNumberUpdateCode(expression, emit, context)
 
-    emit(
-        """%s = CALL_FUNCTION_WITH_NO_ARGS_KWSPLIT(tstate, %s, &PyTuple_GET_ITEM(%s, 0), %s);"""
-        % (
-            to_name,
-            called_name,
-            args_kwsplit_name,
-            context.getConstantCode(kw_names),
+    if _canUseKeywordArgsCache(args_count=0, kw_size=len(kw_names)):
+        _emitCallCodeKwSplitCached(
+            to_name=to_name,
+            called_name=called_name,
+            args_code="NULL",
+            args_count=0,
+            kw_values_code="&PyTuple_GET_ITEM(%s, 0)" % args_kwsplit_name,
+            kw_names=context.getConstantCode(kw_names),
+            emit=emit,
+        )
+    else:
+        emit(
+            """%s = CALL_FUNCTION_WITH_NO_ARGS_KWSPLIT(tstate, %s, &PyTuple_GET_ITEM(%s, 0), %s);"""
+            % (
+                to_name,
+                called_name,
+                args_kwsplit_name,
+                context.getConstantCode(kw_names),
+            )
         )
-    )
 
     getErrorExitCode(
         check_name=to_name,
@@ -251,21 +298,38 @@ def getCallCodeKwSplit(
         """\
 {
     PyObject *kw_values[%(kw_size)d] = {%(kw_value_names)s};
-
-    %(to_name)s = CALL_FUNCTION_WITH_NO_ARGS_KWSPLIT(tstate, %(called_name)s, kw_values, %(kw_names)s);
-}
 """
         % {
-            "to_name": to_name,
             "kw_value_names": ", ".join(
                 str(dict_value_name) for dict_value_name in dict_value_names
             ),
             "kw_size": len(kw_names),
-            "called_name": called_name,
-            "kw_names": context.getConstantCode(tuple(kw_names)),
         }
     )
 
+    if _canUseKeywordArgsCache(args_count=0, kw_size=len(kw_names)):
+        _emitCallCodeKwSplitCached(
+            to_name=to_name,
+            called_name=called_name,
+            args_code="NULL",
+            args_count=0,
+            kw_values_code="kw_values",
+            kw_names=context.getConstantCode(tuple(kw_names)),
+            emit=emit,
+        )
+    else:
+        emit(
+            """\
+    %(to_name)s = CALL_FUNCTION_WITH_NO_ARGS_KWSPLIT(tstate, %(called_name)s, kw_values, %(kw_names)s);"""
+            % {
+                "to_name": to_name,
+                "called_name": called_name,
+                "kw_names": context.getConstantCode(tuple(kw_names)),
+            }
+        )
+
+    emit("}")
+
     getErrorExitCode(
         check_name=to_name,
         release_names=(called_name,) + tuple(dict_value_names),
@@ -559,15 +623,59 @@ def getCallCodeNoArgs(to_name, called_name, expression, emit, context):
     context.addCleanupTempName(to_name)
 
 
+def _canUseMethodCallCache(arg_size):
+    # The cache relies on our own generic attribute lookup, which is not done
+    # for Python 3.11 or higher, and covers the argument counts that have
+    # static helpers.
+    return 0x300 <= python_version < 0x3B0 and arg_size <= 10
+
+
+def _emitInstanceCallCodeCached(
+    to_name, called_name, called_attribute_name, args_code, arg_size, emit
+):
+    # Each call site has its own cache for the type seen last.
+    emit(
+        """\
+{
+    static struct Nuitka_AttributeCache cache;
+    %(to_name)s = CALL_METHOD_WITH_ARGS_CACHED(
+        tstate,
+        %(called_name)s,
+        %(called_attribute_name)s,
+        %(args_code)s,
+        %(arg_size)d,
+        &cache
+    );
+}"""
+        % {
+            "to_name": to_name,
+            "called_name": called_name,
+            "called_attribute_name": called_attribute_name,
+            "args_code": args_code,
+            "arg_size": arg_size,
+        }
+    )
+
+
 def _getInstanceCallCodeNoArgs(
     to_name, called_name, called_attribute_name, expression, emit, context
 ):
     emitLineNumberUpdateCode(expression, emit, context)
 
-    emit(
-        "%s = CALL_METHOD_NO_ARGS(tstate, %s, %s);"
-        % (to_name, called_name, called_attribute_name)
-    )
+    if _canUseMethodCallCache(0):
+        _emitInstanceCallCodeCached(
+            to_name=to_name,
+            called_name=called_name,
+            called_attribute_name=called_attribute_name,
+            args_code="NULL",
+            arg_size=0,
+            emit=emit,
+        )
+    else:
+        emit(
+            "%s = CALL_METHOD_NO_ARGS(tstate, %s, %s);"
+            % (to_name, called_name, called_attribute_name)
+        )
 
     getErrorExitCode(
         check_name=to_name,
@@ -602,9 +710,24 @@ def _getInstanceCallCodePosArgsQuick(
 
     emitLineNumberUpdateCode(expression, emit, context)
 
+    if _canUseMethodCallCache(arg_size):
+        emit("{")
+        emit(
+            "    PyObject *call_args[] = {%s};"
+            % ", ".join(str(arg_name) for arg_name in arg_names)
+        )
+        _emitInstanceCallCodeCached(
+            to_name=to_name,
+            called_name=called_name,
+            called_attribute_name=called_attribute_name,
+            args_code="call_args",
+            arg_size=arg_size,
+            emit=emit,
+        )
+        emit("}")
     # For one argument, we have a dedicated helper function that might
     # be more efficient.
-    if arg_size == 1:
+    elif arg_size == 1:
         emit(
             """%s = CALL_METHOD_WITH_SINGLE_ARG(tstate, %s, %s, %s);"""
             % (to_name, called_name, called_attribute_name, arg_names[0])
@@ -705,8 +828,18 @@ def _getInstanceCallCodeFromTuple(
 
     emitLineNumberUpdateCode(expression, emit, context)
 
-    if arg_size == 1:
-        template = """\
+    if _canUseMethodCallCache(arg_size):
+        _emitInstanceCallCodeCached(
+            to_name=to_name,
+            called_name=called_name,
+            called_attribute_name=called_attribute_name,
+            args_code="&PyTuple_GET_ITEM(%s, 0)" % arg_tuple,
+            arg_size=arg_size,
+            emit=emit,
+        )
+    else:
+        if arg_size == 1:
+            template = """\
 %(to_name)s = CALL_METHOD_WITH_SINGLE_ARG(
     tstate,
     %(called_name)s,
@@ -714,8 +847,8 @@ def _getInstanceCallCodeFromTuple(
     PyTuple_GET_ITEM(%(arg_tuple)s, 0)
 );
 """
-    else:
-        template = """\
+        else:
+            template = """\
 %(to_name)s = CALL_METHOD_WITH_ARGS%(arg_size)d(
     tstate,
     %(called_name)s,
@@ -724,16 +857,16 @@ def _getInstanceCallCodeFromTuple(
 );
 """
 
-    emit(
-        template
-        % {
-            "to_name": to_name,
-            "arg_size": arg_size,
-            "called_name": called_name,
-            "called_attribute_name": called_attribute_name,
-            "arg_tuple": arg_tuple,
-        }
-    )
+        emit(
+            template
+            % {
+                "to_name": to_name,
+                "arg_size": arg_size,
+                "called_name": called_name,
+                "called_attribute_name": called_attribute_name,
+                "arg_tuple": arg_tuple,
+            }
+        )
 
     getErrorExitCode(
         check_name=to_name,
@@ -975,13 +1108,8 @@ def getCallCodePosVariableKeywordVariableArgs(
         """\
 {
     PyObject *args[] = {%(call_arg_names)s};
-    PyObject *kw_values[%(kw_size)d] = {%(kw_value_names)s};
-    %(to_name)s = CALL_FUNCTION_WITH_ARGS%(args_count)d_KWSPLIT(tstate, %(called_name)s, args, kw_values, %(kw_names)s);
-}
-"""
+    PyObject *kw_values[%(kw_size)d] = {%(kw_value_names)s};"""
         % {
-            "to_name": to_name,
-            "called_name": called_name,
             "call_arg_names": ", ".join(
                 str(call_arg_name) for call_arg_name in call_arg_names
             ),
@@ -989,11 +1117,33 @@ def getCallCodePosVariableKeywordVariableArgs(
                 str(dict_value_name) for dict_value_name in dict_value_names
             ),
             "kw_size": len(pairs),
-            "args_count": args_count,
-            "kw_names": context.getConstantCode(tuple(kw_names)),
         }
     )
 
+    if _canUseKeywordArgsCache(args_count=args_count, kw_size=len(pairs)):
+        _emitCallCodeKwSplitCached(
+            to_name=to_name,
+            called_name=called_name,
+            args_code="args",
+            args_count=args_count,
+            kw_values_code="kw_values",
+            kw_names=context.getConstantCode(tuple(kw_names)),
+            emit=emit,
+        )
+    else:
+        emit(
+            """\
+    %(to_name)s = CALL_FUNCTION_WITH_ARGS%(args_count)d_KWSPLIT(tstate, %(called_name)s, args, kw_values, %(kw_names)s);"""
+            % {
+                "to_name": to_name,
+                "called_name": called_name,
+                "args_count": args_count,
+                "kw_names": context.getConstantCode(tuple(kw_names)),
+            }
+        )
+
+    emit("}")
+
     getErrorExitCode(
         check_name=to_name,
         release_names=(called_name,) + tuple(call_arg_names) + tuple(dict_value_names),
@@ -46,7 +46,11 @@ from .ErrorCodes import (
     getReleaseCode,
     getReleaseCodes,
 )
-from .ExpressionCTypeSelectionHelpers import decideExpressionCTypes
+from .ExpressionCTypeSelectionHelpers import (
+    areCFloatOperands,
+    areCLongOperands,
+    decideExpressionCTypes,
+)
 
 
 def _handleArgumentSwapAndInversion(
@@ -67,6 +71,55 @@ def _handleArgumentSwapAndInversion(
     return comparator, needs_result_inversion
 
 
+_c_float_comparison_codes = {
+    "Lt": "<",
+    "LtE": "<=",
+    "Eq": "==",
+    "NotEq": "!=",
+    "Gt": ">",
+    "GtE": ">=",
+}
+
+
+def _getCFloatComparisonCode(to_name, comparator, left, right, emit, context):
+    left_name = context.allocateTempName("cmp_float_left", type_name="double")
+    right_name = context.allocateTempName("cmp_float_right", type_name="double")
+
+    generateExpressionCode(
+        to_name=left_name, expression=left, emit=emit, context=context
+    )
+    generateExpressionCode(
+        to_name=right_name, expression=right, emit=emit, context=context
+    )
+
+    # IEEE comparisons in C behave like the Python ones, also for NaN values.
+    to_name.getCType().emitAssignmentCodeFromBoolCondition(
+        to_name=to_name,
+        condition="%s %s %s"
+        % (left_name, _c_float_comparison_codes[comparator], right_name),
+        emit=emit,
+    )
+
+
+def _getCLongComparisonCode(to_name, comparator, left, right, emit, context):
+    left_name = context.allocateTempName("cmp_long_left", type_name="long")
+    right_name = context.allocateTempName("cmp_long_right", type_name="long")
+
+    generateExpressionCode(
+        to_name=left_name, expression=left, emit=emit, context=context
+    )
+    generateExpressionCode(
+        to_name=right_name, expression=right, emit=emit, context=context
+    )
+
+    to_name.getCType().emitAssignmentCodeFromBoolCondition(
+        to_name=to_name,
+        condition="%s %s %s"
+        % (left_name, _c_float_comparison_codes[comparator], right_name),
+        emit=emit,
+    )
+
+
 def getRichComparisonCode(
     to_name, comparator, left, right, needs_check, source_ref, emit, context
 ):
@@ -74,6 +127,30 @@ def getRichComparisonCode(
     # available, and can be used as a fallback.
     # pylint: disable=too-many-branches,too-many-locals,too-many-statements
 
+    if comparator in _c_float_comparison_codes and areCFloatOperands(
+        left=left, right=right, context=context
+    ):
+        return _getCFloatComparisonCode(
+            to_name=to_name,
+            comparator=comparator,
+            left=left,
+            right=right,
+            emit=emit,
+            context=context,
+        )
+
+    if comparator in _c_float_comparison_codes and areCLongOperands(
+        left=left, right=right, context=context
+    ):
+        return _getCLongComparisonCode(
+            to_name=to_name,
+            comparator=comparator,
+            left=left,
+            right=right,
+            emit=emit,
+            context=context,
+        )
+
     # TODO: Move the value_name to a context generator, then this will be
     # a bit less complex.
     (
@@ -58,6 +58,9 @@ class TempMixin(object):
         self.true_target = None
         self.false_target = None
 
+        # Branch target known from PGO to be taken almost always.
+        self.likely_target = None
+
         self.keeper_variable_count = 0
         self.exception_keepers = (None, None, None, None)
 
@@ -247,6 +250,12 @@ class TempMixin(object):
     def setFalseBranchTarget(self, label):
         self.false_target = label
 
+    def getLikelyBranchTarget(self):
+        return self.likely_target
+
+    def setLikelyBranchTarget(self, label):
+        self.likely_target = label
+
     def getCleanupTempNames(self):
         return self.cleanup_names[-1]
 
@@ -494,6 +503,14 @@ class PythonContextBase(getMetaClassBase("Context")):
     def setFalseBranchTarget(self, label):
         pass
 
+    @abstractmethod
+    def getLikelyBranchTarget(self):
+        pass
+
+    @abstractmethod
+    def setLikelyBranchTarget(self, label):
+        pass
+
     @abstractmethod
     def getCleanupTempNames(self):
         pass
@@ -533,6 +550,15 @@ class PythonChildContextBase(PythonContextBase):
     def getModuleCodeName(self):
         return self.parent.getModuleCodeName()
 
+    def getBuiltinSnapshotIndex(self, builtin_name):
+        return self.parent.getBuiltinSnapshotIndex(builtin_name)
+
+    def allocatePgoBranchProbeIndex(self, line_number):
+        return self.parent.allocatePgoBranchProbeIndex(line_number)
+
+    def allocatePgoProbeSiteIndex(self):
+        return self.parent.allocatePgoProbeSiteIndex()
+
     def getModuleName(self):
         return self.parent.getModuleName()
 
@@ -776,6 +802,18 @@ class PythonModuleContext(
             top_level_name="mod_consts", data_filename=data_filename
         )
 
+        # Names of built-ins read by the module code, their index in the
+        # module snapshot of built-in values.
+        self.builtin_snapshot_indexes = {}
+
+        # Number of PGO branch probes per line, to name several branches on
+        # one line apart.
+        self.pgo_branch_probe_counts = {}
+
+        # Number of PGO probe sites, each has a static variable for the ID
+        # of its name.
+        self.pgo_probe_site_count = 0
+
     def __repr__(self):
         return "<PythonModuleContext instance for module %s>" % self.name
 
@@ -835,6 +873,28 @@ class PythonModuleContext(
     def getConstantsCount(self):
         return self.constant_accessor.getConstantsCount()
 
+    def getBuiltinSnapshotIndex(self, builtin_name):
+        if builtin_name not in self.builtin_snapshot_indexes:
+            self.builtin_snapshot_indexes[builtin_name] = len(
+                self.builtin_snapshot_indexes
+            )
+
+        return self.builtin_snapshot_indexes[builtin_name]
+
+    def getBuiltinSnapshotCount(self):
+        return len(self.builtin_snapshot_indexes)
+
+    def allocatePgoBranchProbeIndex(self, line_number):
+        result = self.pgo_branch_probe_counts.get(line_number, 0)
+        self.pgo_branch_probe_counts[line_number] = result + 1
+
+        return result
+
+    def allocatePgoProbeSiteIndex(self):
+        self.pgo_probe_site_count += 1
+
+        return self.pgo_probe_site_count
+
     def addFunctionCreationInfo(self, creation_info):
         self.function_table_entries.append(creation_info)
 
@@ -1050,6 +1110,12 @@ class PythonFunctionOutlineContext(
     def setFalseBranchTarget(self, label):
         self.parent.setFalseBranchTarget(label)
 
+    def getLikelyBranchTarget(self):
+        return self.parent.getLikelyBranchTarget()
+
+    def setLikelyBranchTarget(self, label):
+        self.parent.setLikelyBranchTarget(label)
+
     def getFrameHandle(self):
         return self.parent.getFrameHandle()
 
@@ -21,6 +21,7 @@ This is first used for comparisons and binary operations, but should see
 general use too and expand beyond constant values, e.g. covering constant
 values that are of behind conditions or variables.
 """
+from nuitka.__past__ import long
 from nuitka.nodes.shapes.BuiltinTypeShapes import (
     tshape_bytearray,
     tshape_bytes,
@@ -29,6 +30,7 @@ from nuitka.nodes.shapes.BuiltinTypeShapes import (
     tshape_long,
     tshape_str,
     tshape_unicode,
+    tshape_xrange_iterator,
 )
 from nuitka.PythonVersions import (
     isPythonValidCLongValue,
@@ -207,3 +209,362 @@ def decideExpressionCTypes(left, right, may_swap_arguments):
         left_c_type,
         right_c_type,
     )
+
+
+# Float operations that cannot raise, and give the same result in C.
+c_float_operator_codes = {
+    "Add": "+",
+    "Sub": "-",
+    "Mult": "*",
+    "IAdd": "+",
+    "ISub": "-",
+    "IMult": "*",
+}
+
+
+def _isCFloatConvertibleConstant(expression):
+    if not expression.isCompileTimeConstant():
+        return False
+
+    constant = expression.getCompileTimeConstant()
+
+    # Integer values must convert to C double without any loss.
+    return type(constant) is float or (
+        type(constant) in (int, long) and abs(constant) <= 2**53
+    )
+
+
+def canComputeAsCFloat(expression, context):
+    """Decide if the value of an expression can be computed as C double.
+
+    These are float constants, unboxed variables and arithmetic done on
+    them, for which C gives the exact same results without any objects.
+    """
+
+    if expression.getTypeShape() is not tshape_float:
+        return False
+
+    if expression.isCompileTimeConstant():
+        return True
+
+    if expression.isExpressionVariableRef() or expression.isExpressionTempVariableRef():
+        # Circular dependency, pylint: disable=cyclic-import
+        from .VariableCodes import getLocalVariableDeclaration
+
+        variable = expression.getVariable()
+
+        return (
+            not variable.isModuleVariable()
+            and getLocalVariableDeclaration(
+                context, variable, expression.getVariableTrace()
+            ).c_type
+            == "double"
+        )
+
+    if (
+        expression.isExpressionOperationBinary()
+        or expression.isExpressionOperationInplace()
+    ):
+        return canComputeBinaryOperationAsCFloat(
+            operator=expression.getOperator(),
+            left=expression.subnode_left,
+            right=expression.subnode_right,
+            context=context,
+        )
+
+    return False
+
+
+def areCFloatOperands(left, right, context):
+    """Decide if both operands can be provided as C double."""
+
+    left_float = canComputeAsCFloat(left, context)
+    right_float = canComputeAsCFloat(right, context)
+
+    if left_float and right_float:
+        return True
+    elif left_float:
+        return _isCFloatConvertibleConstant(right)
+    elif right_float:
+        return _isCFloatConvertibleConstant(left)
+    else:
+        return False
+
+
+def canComputeBinaryOperationAsCFloat(operator, left, right, context):
+    """Decide if a binary operation can be done with C double arithmetic."""
+
+    return operator in c_float_operator_codes and areCFloatOperands(
+        left=left, right=right, context=context
+    )
+
+
+# Integer operations that give the same result in C, as long as there is no
+# overflow, which is ruled out with value bounds.
+c_long_operator_codes = {
+    "Add": "+",
+    "Sub": "-",
+    "Mult": "*",
+    "IAdd": "+",
+    "ISub": "-",
+    "IMult": "*",
+}
+
+# Values that fit into a C "long" on all platforms, it can be 32 bits.
+_c_long_bound = 2**31 - 1
+
+
+def _getIntBoundsUnion(bounds):
+    if None in bounds or not bounds:
+        return None
+
+    return min(bound[0] for bound in bounds), max(bound[1] for bound in bounds)
+
+
+def _getXrangeBounds(expression, seen):
+    if expression.isExpressionConstantXrangeRef():
+        constant = expression.getCompileTimeConstant()
+
+        return (
+            min(constant.start, constant.stop),
+            max(constant.start, constant.stop),
+        )
+
+    if expression.isExpressionBuiltinXrange1():
+        stop_bounds = _getIntBounds(expression.subnode_low, seen)
+
+        if stop_bounds is None:
+            return None
+
+        # Produced values are between start and stop, where start is 0.
+        return _getIntBoundsUnion(((0, 0), stop_bounds))
+
+    if (
+        expression.isExpressionBuiltinXrange2()
+        or expression.isExpressionBuiltinXrange3()
+    ):
+        # The step value only makes values fewer, but it must still be an
+        # "int" value, or it will raise.
+        if (
+            expression.subnode_step is not None
+            and _getIntBounds(expression.subnode_step, seen) is None
+        ):
+            return None
+
+        return _getIntBoundsUnion(
+            (
+                _getIntBounds(expression.subnode_low, seen),
+                _getIntBounds(expression.subnode_high, seen),
+            )
+        )
+
+    return None
+
+
+def _getIteratorValueBounds(expression, seen):
+    # Only "iter(range(...))" assigned to a local variable, which is how "for"
+    # loops are done.
+    if not (
+        expression.isExpressionVariableRef() or expression.isExpressionTempVariableRef()
+    ):
+        return None
+
+    variable = expression.getVariable()
+
+    if variable.isModuleVariable() or variable in seen:
+        return None
+
+    seen.add(variable)
+
+    bounds = []
+
+    for trace in variable.traces:
+        if trace.isInitTrace() or trace.isUnknownTrace():
+            return None
+
+        if trace.isAssignTrace():
+            assign_node = trace.getAssignNode()
+
+            if not assign_node.isStatementAssignmentVariable():
+                return None
+
+            source = assign_node.subnode_source
+
+            if not source.isExpressionBuiltinIter1():
+                return None
+
+            bounds.append(_getXrangeBounds(source.subnode_value, seen))
+
+    seen.discard(variable)
+
+    return _getIntBoundsUnion(bounds)
+
+
+def _getVariableIntBounds(variable, seen):
+    if python_version < 0x300 or variable.isModuleVariable() or variable in seen:
+        return None
+
+    # Guard against cycles, e.g. "x = x + 1" in a loop, has no bounds.
+    seen.add(variable)
+
+    bounds = []
+
+    for trace in variable.traces:
+        if trace.isInitTrace() or trace.isUnknownTrace():
+            return None
+
+        if trace.isAssignTrace():
+            assign_node = trace.getAssignNode()
+
+            if not assign_node.isStatementAssignmentVariable():
+                return None
+
+            bounds.append(_getIntBounds(assign_node.subnode_source, seen))
+
+    seen.discard(variable)
+
+    return _getIntBoundsUnion(bounds)
+
+
+def _getIntBounds(expression, seen):
+    """Lower and upper bounds of an expression value, or None if unknown.
+
+    The value must be known to be an "int" too. Only done for Python3, as
+    Python2 "int" values are a different story.
+    """
+
+    if python_version < 0x300:
+        return None
+
+    if expression.isCompileTimeConstant():
+        constant = expression.getCompileTimeConstant()
+
+        if type(constant) is int:
+            return constant, constant
+        else:
+            return None
+
+    if expression.isExpressionVariableRef() or expression.isExpressionTempVariableRef():
+        return _getVariableIntBounds(expression.getVariable(), seen)
+
+    if expression.isExpressionBuiltinNext1():
+        if expression.subnode_value.getTypeShape() is not tshape_xrange_iterator:
+            return None
+
+        return _getIteratorValueBounds(expression.subnode_value, seen)
+
+    if (
+        expression.isExpressionOperationBinary()
+        or expression.isExpressionOperationInplace()
+    ):
+        operator = expression.getOperator()
+
+        if operator not in c_long_operator_codes:
+            return None
+
+        left_bounds = _getIntBounds(expression.subnode_left, seen)
+        if left_bounds is None:
+            return None
+
+        right_bounds = _getIntBounds(expression.subnode_right, seen)
+        if right_bounds is None:
+            return None
+
+        return _getOperationIntBounds(operator, left_bounds, right_bounds)
+
+    return None
+
+
+def _getOperationIntBounds(operator, left_bounds, right_bounds):
+    left_low, left_high = left_bounds
+    right_low, right_high = right_bounds
+
+    if operator in ("Add", "IAdd"):
+        return left_low + right_low, left_high + right_high
+    elif operator in ("Sub", "ISub"):
+        return left_low - right_high, left_high - right_low
+    else:
+        products = (
+            left_low * right_low,
+            left_low * right_high,
+            left_high * right_low,
+            left_high * right_high,
+        )
+
+        return min(products), max(products)
+
+
+def _isCLongBounds(bounds):
+    return (
+        bounds is not None
+        and -_c_long_bound <= bounds[0]
+        and bounds[1] <= _c_long_bound
+    )
+
+
+def isCLongVariable(variable):
+    """Decide if a variable value is an "int" known to fit into C long."""
+
+    return _isCLongBounds(_getVariableIntBounds(variable, set()))
+
+
+def canComputeAsCLong(expression, context):
+    """Decide if the value of an expression can be computed as C long.
+
+    These are small int constants, unboxed variables and arithmetic done on
+    them, where value bounds rule out any overflow.
+    """
+
+    if expression.isCompileTimeConstant():
+        return _isCLongBounds(_getIntBounds(expression, set()))
+
+    if expression.isExpressionVariableRef() or expression.isExpressionTempVariableRef():
+        # Circular dependency, pylint: disable=cyclic-import
+        from .VariableCodes import getLocalVariableDeclaration
+
+        variable = expression.getVariable()
+
+        return (
+            not variable.isModuleVariable()
+            and getLocalVariableDeclaration(
+                context, variable, expression.getVariableTrace()
+            ).c_type
+            == "long"
+        )
+
+    if (
+        expression.isExpressionOperationBinary()
+        or expression.isExpressionOperationInplace()
+    ):
+        return canComputeBinaryOperationAsCLong(
+            operator=expression.getOperator(),
+            left=expression.subnode_left,
+            right=expression.subnode_right,
+            context=context,
+        )
+
+    return False
+
+
+def areCLongOperands(left, right, context):
+    """Decide if both operands can be provided as C long."""
+
+    return canComputeAsCLong(left, context) and canComputeAsCLong(right, context)
+
+
+def canComputeBinaryOperationAsCLong(operator, left, right, context):
+    """Decide if a binary operation can be done with C long arithmetic."""
+
+    if operator not in c_long_operator_codes:
+        return False
+
+    if not areCLongOperands(left=left, right=right, context=context):
+        return False
+
+    return _isCLongBounds(
+        _getOperationIntBounds(
+            operator,
+            _getIntBounds(left, set()),
+            _getIntBounds(right, set()),
+        )
+    )
@@ -197,6 +197,10 @@ def getTypeSizeOf(type_indicator):
         return "sizeof(nuitka_bool)"
     elif type_indicator == "L":
         return "sizeof(nuitka_ilong)"
+    elif type_indicator == "d":
+        return "sizeof(double)"
+    elif type_indicator == "l":
+        return "sizeof(long)"
     else:
         assert False, type_indicator
 
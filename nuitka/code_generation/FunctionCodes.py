@@ -20,6 +20,8 @@
 """
 
 
+from nuitka.Options import shallCreatePgoInput
+from nuitka.pgo.PGO import getFunctionCallCountFromPGO
 from nuitka.PythonVersions import python_version
 from nuitka.Tracing import general
 
@@ -591,8 +593,16 @@ def finalizeFunctionLocalVariables(context):
             variable=variable,
             variable_trace=None,  # TODO: See other uses of None.
         )
-        function_cleanup.append("CHECK_OBJECT(%s);" % variable_declaration)
-        function_cleanup.append("Py_DECREF(%s);" % variable_declaration)
+        variable_c_type = variable_declaration.getCType()
+
+        variable_c_type.emitReleaseAssertionCode(
+            value_name=variable_declaration, emit=function_cleanup.append
+        )
+        variable_c_type.getReleaseCode(
+            value_name=variable_declaration,
+            needs_check=False,
+            emit=function_cleanup.append,
+        )
 
     return function_cleanup
 
@@ -649,6 +659,34 @@ def _getFunctionCode(
 
     function_codes = SourceCodeCollector()
 
+    if shallCreatePgoInput():
+        # The name is interned only once, and kept in a static variable.
+        pgo_probe_id = "pgo_probe_id_%d" % context.allocatePgoProbeSiteIndex()
+
+        function_codes.emit("static uint32_t %s = 0;" % pgo_probe_id)
+        function_codes.emit(
+            'PGO_onFunctionEntered(PGO_PROBE_ID(%s, "%s:%s"));'
+            % (
+                pgo_probe_id,
+                context.getModuleName(),
+                context.getOwner().getFunctionQualname(),
+            )
+        )
+
+        function_attributes = ""
+    elif (
+        getFunctionCallCountFromPGO(
+            module_name=context.getModuleName(),
+            function_qualname=context.getOwner().getFunctionQualname(),
+        )
+        == 0
+    ):
+        # Never called in the PGO run, so optimize it for size, and keep it
+        # away from the code that is used.
+        function_attributes = "NUITKA_COLD "
+    else:
+        function_attributes = ""
+
     generateStatementSequenceCode(
         statement_sequence=context.getOwner().subnode_body,
         allow_none=True,
@@ -715,6 +753,7 @@ def _getFunctionCode(
             )
 
         result += function_direct_body_template % {
+            "function_attributes": function_attributes,
             "file_scope": file_scope,
             "function_identifier": function_identifier,
             "direct_call_arg_spec": ", ".join(parameter_objects_decl),
@@ -724,6 +763,7 @@ def _getFunctionCode(
         }
     else:
         result += template_function_body % {
+            "function_attributes": function_attributes,
             "function_identifier": function_identifier,
             "parameter_objects_decl": ", ".join(parameter_objects_decl),
             "function_locals": indented(function_locals),
@@ -48,6 +48,14 @@ def getBranchingCode(condition, emit, context):
     else:
         assert true_target is not None and false_target is not None
 
+        # Branch prediction from PGO, only for the branch that asked for it.
+        likely_target = context.getLikelyBranchTarget()
+
+        if likely_target is true_target:
+            condition = "likely(%s)" % condition
+        elif likely_target is false_target:
+            condition = "unlikely(%s)" % condition
+
         emit(
             """\
 if (%s) {
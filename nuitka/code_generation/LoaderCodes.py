@@ -36,7 +36,6 @@ import sys
 from nuitka import Options
 from nuitka.ModuleRegistry import (
     getDoneModules,
-    getUncompiledModules,
     getUncompiledTechnicalModules,
 )
 from nuitka.plugins.Plugins import Plugins
@@ -120,13 +119,12 @@ def getMetaPathLoaderBodyCode(bytecode_accessor):
     metapath_loader_inittab = []
     metapath_module_decls = []
 
-    uncompiled_modules = getUncompiledModules()
-
-    for other_module in getDoneModules():
-        # Put those at the end.
-        if other_module in uncompiled_modules:
-            continue
+    # The loader does binary search on the entries, so they need to be sorted
+    # by name, in the byte order that "strcmp" uses.
+    def getModuleSortKey(module):
+        return module.getFullName().asString().encode("utf8")
 
+    for other_module in sorted(getDoneModules(), key=getModuleSortKey):
         metapath_loader_inittab.append(
             getModuleMetaPathLoaderEntryCode(
                 module=other_module, bytecode_accessor=bytecode_accessor
@@ -141,14 +139,6 @@ PyThreadState *tstate, PyObject *, struct Nuitka_MetaPathBasedLoaderEntry const
                 % {"module_identifier": other_module.getCodeName()}
             )
 
-    # Do them now
-    for uncompiled_module in uncompiled_modules:
-        metapath_loader_inittab.append(
-            getModuleMetaPathLoaderEntryCode(
-                module=uncompiled_module, bytecode_accessor=bytecode_accessor
-            )
-        )
-
     frozen_defs = []
 
     # Only the non-technical ones need to be there.
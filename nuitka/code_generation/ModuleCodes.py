@@ -38,6 +38,9 @@ from .templates.CodeTemplatesModules import (
     template_module_external_entry_point,
     template_module_no_exception_exit,
 )
+from .templates.CodeTemplatesVariables import (
+    template_module_builtins_snapshot,
+)
 from .VariableCodes import getVariableReferenceCode
 
 
@@ -81,6 +84,14 @@ def getModuleCode(
     for _identifier, code in sorted(iterItems(context.getHelperCodes())):
         function_body_codes.append(code)
 
+    # All code is generated now, so the used built-ins are known.
+    builtins_count = context.getBuiltinSnapshotCount()
+    if builtins_count:
+        context.addDeclaration(
+            "mod_builtins",
+            template_module_builtins_snapshot % {"builtins_count": builtins_count},
+        )
+
     for _identifier, code in sorted(iterItems(context.getDeclarations())):
         function_decl_codes.append(code)
 
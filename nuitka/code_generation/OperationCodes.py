@@ -46,7 +46,13 @@ from .ErrorCodes import (
     getReleaseCodes,
     getTakeReferenceCode,
 )
-from .ExpressionCTypeSelectionHelpers import decideExpressionCTypes
+from .ExpressionCTypeSelectionHelpers import (
+    c_float_operator_codes,
+    c_long_operator_codes,
+    canComputeBinaryOperationAsCFloat,
+    canComputeBinaryOperationAsCLong,
+    decideExpressionCTypes,
+)
 
 
 def generateOperationBinaryCode(to_name, expression, emit, context):
@@ -102,12 +108,115 @@ def generateOperationUnaryCode(to_name, expression, emit, context):
     )
 
 
+def _getCFloatBinaryOperationCode(to_name, operator, left, right, emit, context):
+    left_name = context.allocateTempName(
+        "%s_float_left" % operator.lower(), type_name="double"
+    )
+    right_name = context.allocateTempName(
+        "%s_float_right" % operator.lower(), type_name="double"
+    )
+
+    generateExpressionCode(
+        to_name=left_name, expression=left, emit=emit, context=context
+    )
+    generateExpressionCode(
+        to_name=right_name, expression=right, emit=emit, context=context
+    )
+
+    # Only box the value, if the target is not a C double as well.
+    if to_name.c_type == "double":
+        value_name = to_name
+    else:
+        value_name = context.allocateTempName(
+            "%s_float_result" % operator.lower(), type_name="double"
+        )
+
+    emit(
+        "%s = %s %s %s;"
+        % (value_name, left_name, c_float_operator_codes[operator], right_name)
+    )
+
+    if value_name is not to_name:
+        to_name.getCType().emitAssignConversionCode(
+            to_name=to_name,
+            value_name=value_name,
+            needs_check=False,
+            emit=emit,
+            context=context,
+        )
+
+
+def _getCLongBinaryOperationCode(to_name, operator, left, right, emit, context):
+    left_name = context.allocateTempName(
+        "%s_long_left" % operator.lower(), type_name="long"
+    )
+    right_name = context.allocateTempName(
+        "%s_long_right" % operator.lower(), type_name="long"
+    )
+
+    generateExpressionCode(
+        to_name=left_name, expression=left, emit=emit, context=context
+    )
+    generateExpressionCode(
+        to_name=right_name, expression=right, emit=emit, context=context
+    )
+
+    # Only box the value, if the target is not a C long as well.
+    if to_name.c_type == "long":
+        value_name = to_name
+    else:
+        value_name = context.allocateTempName(
+            "%s_long_result" % operator.lower(), type_name="long"
+        )
+
+    emit(
+        "%s = %s %s %s;"
+        % (value_name, left_name, c_long_operator_codes[operator], right_name)
+    )
+
+    if value_name is not to_name:
+        to_name.getCType().emitAssignConversionCode(
+            to_name=to_name,
+            value_name=value_name,
+            needs_check=False,
+            emit=emit,
+            context=context,
+        )
+
+
 def _getBinaryOperationCode(
     to_name, operator, inplace, left, right, needs_check, source_ref, emit, context
 ):
     # This is detail rich stuff, encoding the complexity of what helpers are
     # available, and can be used as a fallback.
     # pylint: disable=too-many-branches,too-many-locals,too-many-statements
+
+    # Floats have value semantics, so this covers in-place operations as well.
+    if canComputeBinaryOperationAsCFloat(
+        operator=operator, left=left, right=right, context=context
+    ):
+        return _getCFloatBinaryOperationCode(
+            to_name=to_name,
+            operator=operator,
+            left=left,
+            right=right,
+            emit=emit,
+            context=context,
+        )
+
+    # Value bounds rule out overflows, so C long gives the same result.
+    if canComputeBinaryOperationAsCLong(
+        operator=operator, left=left, right=right, context=context
+    ):
+        return _getCLongBinaryOperationCode(
+            to_name=to_name,
+            operator=operator,
+            left=left,
+            right=right,
+            emit=emit,
+            context=context,
+        )
+
     (
         _unknown_types,
         needs_argument_swap,
@@ -33,6 +33,8 @@ _missing_trust = OrderedDict()
 
 _missing_overloads = OrderedDict()
 
+_unboxed_variables = OrderedDict()
+
 _error_for_missing = False
 # _error_for_missing = True
 
@@ -75,6 +77,19 @@ def doMissingOptimizationReport():
             optimization_logger.info(message)
 
 
+def doUnboxedVariablesReport():
+    for variable, c_type in _unboxed_variables.items():
+        optimization_logger.info(
+            "Unboxed variable '%s' of '%s' to C type '%s' at %s"
+            % (
+                variable.getName(),
+                variable.getOwner().getCodeName(),
+                c_type.c_type,
+                variable.getOwner().getSourceReference().getAsString(),
+            )
+        )
+
+
 def onMissingHelper(helper_name, source_ref):
     if source_ref:
         if helper_name not in _missing_helpers:
@@ -103,3 +118,7 @@ def onMissingOverload(method_name, node):
         _missing_overloads[method_name] = OrderedSet()
 
     _missing_overloads[method_name].add(node.kind)
+
+
+def onUnboxedVariable(variable, c_type):
+    _unboxed_variables[variable] = c_type
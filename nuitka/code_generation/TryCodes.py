@@ -23,6 +23,8 @@ structure used, where exception handling and everything is made explicit.
 """
 
 from nuitka import Options
+from nuitka.PythonVersions import python_version
+from nuitka.tree.Operations import VisitorNoopMixin, visitTree
 
 from .CodeHelpers import generateExpressionCode, generateStatementSequenceCode
 from .ErrorCodes import getMustNotGetHereCode
@@ -41,6 +43,9 @@ def generateTryCode(statement, emit, context):
     if generateTryNextExceptStopIterationCode(statement, emit, context):
         return
 
+    if generateTryExceptSwallowBuiltinCode(statement, emit, context):
+        return
+
     # Get the statement sequences involved. All except the tried block can be
     # None. For the tried block it would be a missed optimization. Also not all
     # the handlers must be None, then it's also a missed optimization.
@@ -334,3 +339,215 @@ def generateTryNextExceptStopIterationCode(statement, emit, context):
             context.removeCleanupTempName(tmp_name2)
 
     return True
+
+
+class _CaughtExceptionRefVisitor(VisitorNoopMixin):
+    """Find references to the caught exception, e.g. from "except X as e"."""
+
+    def __init__(self):
+        self.found = False
+
+    def onEnterNode(self, node):
+        if node.kind in (
+            "EXPRESSION_CAUGHT_EXCEPTION_TYPE_REF",
+            "EXPRESSION_CAUGHT_EXCEPTION_VALUE_REF",
+            "EXPRESSION_CAUGHT_EXCEPTION_TRACEBACK_REF",
+        ):
+            self.found = True
+
+
+def _hasCaughtExceptionRefs(statement_sequence):
+    visitor = _CaughtExceptionRefVisitor()
+    visitTree(statement_sequence, visitor)
+
+    return visitor.found
+
+
+def _getSwallowedBuiltinExceptionHandler(except_handler):
+    """Detect handlers only swallowing one built-in exception.
+
+    Returns exception name and handler body, or None if the handler doesn't
+    have that form. Since the handler body cannot raise, or reference the
+    caught exception, nothing can observe the published exception, or chain
+    it to another one.
+    """
+
+    # This has many branches which mean this optimized code generation is not
+    # applicable, we return each time. pylint: disable=too-many-return-statements
+
+    handling_statements = except_handler.subnode_statements
+
+    if len(handling_statements) not in (3, 4):
+        return None
+
+    if (
+        not handling_statements[0].isStatementPreserveFrameException()
+        or not handling_statements[1].isStatementPublishException()
+        or not handling_statements[2].isStatementTry()
+    ):
+        return None
+
+    if (
+        len(handling_statements) == 4
+        and not handling_statements[3].isStatementRestoreFrameException()
+    ):
+        return None
+
+    restoring_try = handling_statements[2]
+
+    for handler in (
+        restoring_try.subnode_except_handler,
+        restoring_try.subnode_break_handler,
+        restoring_try.subnode_continue_handler,
+        restoring_try.subnode_return_handler,
+    ):
+        if (
+            handler is not None
+            and not handler.subnode_statements[0].isStatementRestoreFrameException()
+        ):
+            return None
+
+    tried_statements = restoring_try.subnode_tried.subnode_statements
+
+    if len(tried_statements) != 1 or not tried_statements[0].isStatementConditional():
+        return None
+
+    condition = tried_statements[0].subnode_condition
+
+    if condition.isExpressionComparisonExceptionMatch():
+        handler_body = tried_statements[0].subnode_yes_branch
+        reraise_branch = tried_statements[0].subnode_no_branch
+    elif condition.isExpressionComparisonExceptionMismatch():
+        handler_body = tried_statements[0].subnode_no_branch
+        reraise_branch = tried_statements[0].subnode_yes_branch
+    else:
+        return None
+
+    if (
+        not condition.subnode_left.isExpressionCaughtExceptionTypeRef()
+        or not condition.subnode_right.isExpressionBuiltinExceptionRef()
+    ):
+        return None
+
+    if (
+        reraise_branch is None
+        or len(reraise_branch.subnode_statements) != 1
+        or not reraise_branch.subnode_statements[0].isStatementReraiseException()
+    ):
+        return None
+
+    if handler_body is not None and handler_body.mayRaiseException(BaseException):
+        return None
+
+    # The released exception is not published, so "sys.exc_info()" would not
+    # give it to these references.
+    if handler_body is not None and _hasCaughtExceptionRefs(handler_body):
+        return None
+
+    return condition.subnode_right.getExceptionName(), handler_body
+
+
+def generateTryExceptSwallowBuiltinCode(statement, emit, context):
+    """Try/except code for handlers that only swallow a built-in exception.
+
+    The exception is matched by its type, and then released, without creating
+    a traceback for it, normalizing and publishing it, all of which cannot be
+    observed with such handlers. Otherwise it is passed on unchanged.
+    """
+
+    # Exception publishing has side effects for Python2, and with full
+    # compatibility, code running from "__del__" might look at it.
+    if python_version < 0x300 or Options.is_full_compat:
+        return False
+
+    except_handler = statement.subnode_except_handler
+
+    if except_handler is None:
+        return False
+
+    if (
+        statement.subnode_break_handler is not None
+        or statement.subnode_continue_handler is not None
+        or statement.subnode_return_handler is not None
+    ):
+        return False
+
+    swallowed = _getSwallowedBuiltinExceptionHandler(except_handler)
+
+    if swallowed is None:
+        return False
+
+    exception_name, handler_body = swallowed
+
+    tried_handler_escape = context.allocateLabel("try_except_handler")
+    old_exception_escape = context.setExceptionEscape(tried_handler_escape)
+
+    emit("// Tried code:")
+    generateStatementSequenceCode(
+        statement_sequence=statement.subnode_tried,
+        emit=emit,
+        allow_none=False,
+        context=context,
+    )
+
+    context.setExceptionEscape(old_exception_escape)
+
+    post_label = None
+
+    if not statement.subnode_tried.isStatementAborting():
+        post_label = context.allocateLabel("try_end")
+
+        getGotoCode(post_label, emit)
+    else:
+        getMustNotGetHereCode(reason="tried codes exits in all cases", emit=emit)
+
+    (
+        exception_type,
+        exception_value,
+        exception_tb,
+        exception_lineno,
+    ) = context.variable_storage.getExceptionVariableDescriptions()
+
+    emit("// Exception handler code, only swallowing %s:" % exception_name)
+    getLabelCode(tried_handler_escape, emit)
+
+    emit(
+        """\
+if (!EXCEPTION_MATCH_BOOL_SINGLE(tstate, %(exception_type)s, PyExc_%(exception_name)s)) {
+    goto %(exception_escape)s;
+}
+
+Py_DECREF(%(exception_type)s);
+Py_XDECREF(%(exception_value)s);
+Py_XDECREF(%(exception_tb)s);
+%(exception_type)s = NULL;
+%(exception_value)s = NULL;
+%(exception_tb)s = NULL;
+%(exception_lineno)s = 0;
+"""
+        % {
+            "exception_type": exception_type,
+            "exception_value": exception_value,
+            "exception_tb": exception_tb,
+            "exception_lineno": exception_lineno,
+            "exception_name": exception_name,
+            "exception_escape": context.getExceptionEscape(),
+        }
+    )
+
+    generateStatementSequenceCode(
+        statement_sequence=handler_body, emit=emit, allow_none=True, context=context
+    )
+
+    if handler_body is None or not handler_body.isStatementAborting():
+        if post_label is None:
+            post_label = context.allocateLabel("try_end")
+
+        getGotoCode(post_label, emit)
+
+    emit("// End of try:")
+
+    if post_label is not None:
+        getLabelCode(post_label, emit)
+
+    return True
@@ -19,12 +19,16 @@
 
 """
 
+from nuitka.Builtins import builtin_names
 from nuitka.nodes.shapes.BuiltinTypeShapes import (
     tshape_bool,
+    tshape_int,
     tshape_int_or_long,
 )
 from nuitka.PythonVersions import python_version
 
+from .c_types.CTypeCFloats import CTypeCFloat
+from .c_types.CTypeCLongs import CTypeCLong
 from .c_types.CTypeNuitkaBooleans import CTypeNuitkaBoolEnum
 from .c_types.CTypePyObjectPointers import (
     CTypeCellObject,
@@ -42,6 +46,13 @@ from .ErrorCodes import (
     getLocalVariableReferenceErrorCode,
     getNameReferenceErrorCode,
 )
+from .ExpressionCTypeSelectionHelpers import (
+    canComputeAsCFloat,
+    canComputeAsCLong,
+    isCLongVariable,
+)
+from .Reports import onUnboxedVariable
+from .templates.CodeTemplatesVariables import template_read_mvar_cached
 from .VariableDeclarations import VariableDeclaration
 
 
@@ -68,6 +79,14 @@ def generateAssignmentVariableCode(statement, emit, context):
             and variable_declaration.c_type == "nuitka_ilong"
         ):
             tmp_name = context.allocateTempName("assign_source", "nuitka_ilong")
+        elif variable_declaration.c_type == "double" and canComputeAsCFloat(
+            assign_source, context
+        ):
+            tmp_name = context.allocateTempName("assign_source", "double")
+        elif variable_declaration.c_type == "long" and canComputeAsCLong(
+            assign_source, context
+        ):
+            tmp_name = context.allocateTempName("assign_source", "long")
         else:
             tmp_name = context.allocateTempName("assign_source")
 
@@ -115,10 +134,42 @@ def getVariableReferenceCode(
             # TODO: Rather have this passed from a distinct node type, so inlining
             # doesn't change things.
 
-            emit(
-                """\
+            if 0x360 <= python_version < 0x3C0:
+                if variable.getName() in builtin_names:
+                    builtins_snapshot = "&mod_builtins_snapshot"
+                    builtin_id = context.getBuiltinSnapshotIndex(variable.getName())
+                else:
+                    builtins_snapshot = "NULL"
+                    builtin_id = 0
+
+                emit(
+                    template_read_mvar_cached
+                    % {
+                        "module_identifier": context.getModuleCodeName(),
+                        "tmp_name": value_name,
+                        "var_name": context.getConstantCode(
+                            constant=variable.getName()
+                        ),
+                        "builtins_snapshot": builtins_snapshot,
+                        "builtin_id": builtin_id,
+                    }
+                )
+            else:
+                emit(
+                    """\
 %(value_name)s = GET_STRING_DICT_VALUE(moduledict_%(module_identifier)s, (Nuitka_StringObject *)%(var_name)s);
+"""
+                    % {
+                        "module_identifier": context.getModuleCodeName(),
+                        "value_name": value_name,
+                        "var_name": context.getConstantCode(
+                            constant=variable.getName()
+                        ),
+                    }
+                )
 
+            emit(
+                """\
 if (unlikely(%(value_name)s == NULL)) {
     %(value_name)s = %(helper_code)s(tstate, %(var_name)s);
 }
@@ -222,7 +273,21 @@ def getPickedCType(variable, context):
                 # the future.
                 result = CTypePyObjectPtr
             else:
-                result = shapes.pop().getCType()
+                shape = shapes.pop()
+                result = shape.getCType()
+
+                # Only "int" values with known bounds, e.g. from iterating
+                # over a "range", are known to fit into a C long.
+                if shape is tshape_int and isCLongVariable(variable):
+                    result = CTypeCLong
+
+                # There is no unassigned value for C double and C long, so they
+                # can only be used when that state can never be observed.
+                if result in (CTypeCFloat, CTypeCLong):
+                    if variable.mustHaveValueWhenRead():
+                        onUnboxedVariable(variable, result)
+                    else:
+                        result = CTypePyObjectPtr
 
     elif context.isForDirectCall():
         if variable.isSharedTechnically():
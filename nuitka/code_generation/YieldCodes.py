@@ -29,6 +29,34 @@ from .PythonAPICodes import getReferenceExportCode
 from .VariableDeclarations import VariableDeclaration
 
 
+def _getHeapPreservationCode(yield_tmp_storage, locals_preserved, restore, emit):
+    """Copy values that must survive a yield to or from the heap storage.
+
+    The offsets and sizes are all compile time constants, so the C compiler
+    turns these into plain moves, instead of a loop over a varargs list.
+    """
+
+    # Offset expression by types already placed, e.g. "2 * sizeof(PyObject *)".
+    type_counts = {}
+
+    for local_preserved in locals_preserved:
+        c_type = local_preserved.c_type
+
+        offset = " + ".join(
+            "%d * sizeof(%s)" % (count, placed_c_type)
+            for placed_c_type, count in sorted(type_counts.items())
+        )
+
+        storage = "&%s[%s]" % (yield_tmp_storage, offset or "0")
+
+        if restore:
+            emit("memcpy(&%s, %s, sizeof(%s));" % (local_preserved, storage, c_type))
+        else:
+            emit("memcpy(%s, &%s, sizeof(%s));" % (storage, local_preserved, c_type))
+
+        type_counts[c_type] = type_counts.get(c_type, 0) + 1
+
+
 def _getYieldPreserveCode(
     to_name, value_name, preserve_exception, yield_code, resume_code, emit, context
 ):
@@ -62,15 +90,11 @@ def _getYieldPreserveCode(
                 "char[1024]", "yield_tmps", None
             )
 
-        emit(
-            "Nuitka_PreserveHeap(%s, %s, NULL);"
-            % (
-                yield_tmp_storage,
-                ", ".join(
-                    "&%s, sizeof(%s)" % (local_preserved, local_preserved.c_type)
-                    for local_preserved in locals_preserved
-                ),
-            )
+        _getHeapPreservationCode(
+            yield_tmp_storage=yield_tmp_storage,
+            locals_preserved=locals_preserved,
+            restore=False,
+            emit=emit,
         )
 
     if preserve_exception:
@@ -101,15 +125,11 @@ def _getYieldPreserveCode(
         )
 
     if locals_preserved:
-        emit(
-            "Nuitka_RestoreHeap(%s, %s, NULL);"
-            % (
-                yield_tmp_storage,
-                ", ".join(
-                    "&%s, sizeof(%s)" % (local_preserved, local_preserved.c_type)
-                    for local_preserved in locals_preserved
-                ),
-            )
+        _getHeapPreservationCode(
+            yield_tmp_storage=yield_tmp_storage,
+            locals_preserved=locals_preserved,
+            restore=True,
+            emit=emit,
         )
 
     if resume_code:
@@ -27,6 +27,8 @@ type_indicators = {
     "struct Nuitka_CellObject *": "c",
     "nuitka_bool": "b",
     "nuitka_ilong": "L",
+    "double": "d",
+    "long": "l",
 }
 
 
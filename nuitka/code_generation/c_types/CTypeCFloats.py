@@ -21,10 +21,12 @@
 
 from math import copysign, isinf, isnan
 
-from .CTypeBases import CTypeBase
+from nuitka.code_generation.ErrorCodes import getReleaseCode
 
+from .CTypeBases import CTypeBase, CTypeNotReferenceCountedMixin
 
-class CTypeCFloat(CTypeBase):
+
+class CTypeCFloat(CTypeNotReferenceCountedMixin, CTypeBase):
     c_type = "double"
 
     helper_code = "CFLOAT"
@@ -53,3 +55,78 @@ class CTypeCFloat(CTypeBase):
             c_constant = constant
 
         emit("%s = %s;" % (to_name, c_constant))
+
+    @classmethod
+    def emitVariableAssignCode(
+        cls, value_name, needs_release, tmp_name, ref_count, inplace, emit, context
+    ):
+        # Values cannot be modified in place, so "inplace" makes no difference
+        # for this type, pylint: disable=unused-argument
+
+        if tmp_name.c_type == "double":
+            emit("%s = %s;" % (value_name, tmp_name))
+        else:
+            assert tmp_name.c_type == "PyObject *", tmp_name
+
+            emit("assert(PyFloat_CheckExact(%s));" % tmp_name)
+            emit("%s = PyFloat_AS_DOUBLE(%s);" % (value_name, tmp_name))
+
+            # The caller removes the cleanup for the transferred reference.
+            if ref_count:
+                tmp_name.getCType().getReleaseCode(
+                    value_name=tmp_name, needs_check=False, emit=emit
+                )
+
+    @classmethod
+    def emitValueAccessCode(cls, value_name, emit, context):
+        # Nothing to do for this type, pylint: disable=unused-argument
+        return value_name
+
+    @classmethod
+    def emitValueAssertionCode(cls, value_name, emit):
+        # Every bit pattern is a valid value.
+        pass
+
+    @classmethod
+    def emitAssignConversionCode(cls, to_name, value_name, needs_check, emit, context):
+        if value_name.c_type == cls.c_type:
+            emit("%s = %s;" % (to_name, value_name))
+        else:
+            assert value_name.c_type == "PyObject *", value_name
+
+            emit("assert(PyFloat_CheckExact(%s));" % value_name)
+            emit("%s = PyFloat_AS_DOUBLE(%s);" % (to_name, value_name))
+
+            getReleaseCode(value_name, emit, context)
+
+    @classmethod
+    def emitAssignmentCodeToNuitkaBool(
+        cls, to_name, value_name, needs_check, emit, context
+    ):
+        # Half way, virtual method: pylint: disable=unused-argument
+        emit(
+            "%s = %s ? NUITKA_BOOL_TRUE : NUITKA_BOOL_FALSE;"
+            % (to_name, cls.getTruthCheckCode(value_name))
+        )
+
+    @classmethod
+    def getTruthCheckCode(cls, value_name):
+        # NaN values are true in Python, and also compare unequal in C.
+        return "%s != 0.0" % value_name
+
+    @classmethod
+    def getInitValue(cls, init_from):
+        assert init_from is None, init_from
+
+        return "0.0"
+
+    @classmethod
+    def getInitTestConditionCode(cls, value_name, inverted):
+        # There is no unassigned value, variables only get this type if they
+        # cannot be read before assignment, pylint: disable=unused-argument
+        return "false" if inverted else "true"
+
+    @classmethod
+    def emitReinitCode(cls, value_name, emit):
+        # There is no unassigned value to go back to.
+        pass
@@ -20,7 +20,9 @@
 """
 
 
-from .CTypeBases import CTypeBase
+from nuitka.code_generation.ErrorCodes import getReleaseCode
+
+from .CTypeBases import CTypeBase, CTypeNotReferenceCountedMixin
 
 
 class CTypeCLongMixin(CTypeBase):
@@ -32,11 +34,86 @@ class CTypeCLongMixin(CTypeBase):
         emit("%s = %s;" % (to_name, constant))
 
 
-class CTypeCLong(CTypeCLongMixin, CTypeBase):
+class CTypeCLong(CTypeNotReferenceCountedMixin, CTypeCLongMixin, CTypeBase):
     c_type = "long"
 
     helper_code = "CLONG"
 
+    @classmethod
+    def emitVariableAssignCode(
+        cls, value_name, needs_release, tmp_name, ref_count, inplace, emit, context
+    ):
+        # Values cannot be modified in place, so "inplace" makes no difference
+        # for this type, pylint: disable=unused-argument
+
+        if tmp_name.c_type == "long":
+            emit("%s = %s;" % (value_name, tmp_name))
+        else:
+            assert tmp_name.c_type == "PyObject *", tmp_name
+
+            # Only values known to fit get this type, so no overflow check.
+            emit("assert(PyLong_CheckExact(%s));" % tmp_name)
+            emit("%s = PyLong_AsLong(%s);" % (value_name, tmp_name))
+
+            # The caller removes the cleanup for the transferred reference.
+            if ref_count:
+                tmp_name.getCType().getReleaseCode(
+                    value_name=tmp_name, needs_check=False, emit=emit
+                )
+
+    @classmethod
+    def emitValueAccessCode(cls, value_name, emit, context):
+        # Nothing to do for this type, pylint: disable=unused-argument
+        return value_name
+
+    @classmethod
+    def emitValueAssertionCode(cls, value_name, emit):
+        # Every bit pattern is a valid value.
+        pass
+
+    @classmethod
+    def emitAssignConversionCode(cls, to_name, value_name, needs_check, emit, context):
+        if value_name.c_type == cls.c_type:
+            emit("%s = %s;" % (to_name, value_name))
+        else:
+            assert value_name.c_type == "PyObject *", value_name
+
+            emit("assert(PyLong_CheckExact(%s));" % value_name)
+            emit("%s = PyLong_AsLong(%s);" % (to_name, value_name))
+
+            getReleaseCode(value_name, emit, context)
+
+    @classmethod
+    def emitAssignmentCodeToNuitkaBool(
+        cls, to_name, value_name, needs_check, emit, context
+    ):
+        # Half way, virtual method: pylint: disable=unused-argument
+        emit(
+            "%s = %s ? NUITKA_BOOL_TRUE : NUITKA_BOOL_FALSE;"
+            % (to_name, cls.getTruthCheckCode(value_name))
+        )
+
+    @classmethod
+    def getTruthCheckCode(cls, value_name):
+        return "%s != 0" % value_name
+
+    @classmethod
+    def getInitValue(cls, init_from):
+        assert init_from is None, init_from
+
+        return "0"
+
+    @classmethod
+    def getInitTestConditionCode(cls, value_name, inverted):
+        # There is no unassigned value, variables only get this type if they
+        # cannot be read before assignment, pylint: disable=unused-argument
+        return "false" if inverted else "true"
+
+    @classmethod
+    def emitReinitCode(cls, value_name, emit):
+        # There is no unassigned value to go back to.
+        pass
+
 
 class CTypeCLongDigit(CTypeCLongMixin, CTypeBase):
     c_type = "nuitka_digit"
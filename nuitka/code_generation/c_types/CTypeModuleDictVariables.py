@@ -23,11 +23,14 @@
 
 """
 
+from nuitka.Builtins import builtin_names
 from nuitka.code_generation.templates.CodeTemplatesVariables import (
     template_del_global_known,
     template_del_global_unclear,
+    template_read_mvar_cached,
     template_read_mvar_unclear,
 )
+from nuitka.PythonVersions import python_version
 
 from .CTypeBases import CTypeBase
 
@@ -70,14 +73,33 @@ if (%(orig_name)s != %(tmp_name)s) {
     def emitValueAccessCode(cls, value_name, emit, context):
         tmp_name = context.allocateTempName("mvar_value")
 
-        emit(
-            template_read_mvar_unclear
-            % {
-                "module_identifier": context.getModuleCodeName(),
-                "tmp_name": tmp_name,
-                "var_name": context.getConstantCode(constant=value_name.code_name),
-            }
-        )
+        if 0x360 <= python_version < 0x3C0:
+            if value_name.code_name in builtin_names:
+                builtins_snapshot = "&mod_builtins_snapshot"
+                builtin_id = context.getBuiltinSnapshotIndex(value_name.code_name)
+            else:
+                builtins_snapshot = "NULL"
+                builtin_id = 0
+
+            emit(
+                template_read_mvar_cached
+                % {
+                    "module_identifier": context.getModuleCodeName(),
+                    "tmp_name": tmp_name,
+                    "var_name": context.getConstantCode(constant=value_name.code_name),
+                    "builtins_snapshot": builtins_snapshot,
+                    "builtin_id": builtin_id,
+                }
+            )
+        else:
+            emit(
+                template_read_mvar_unclear
+                % {
+                    "module_identifier": context.getModuleCodeName(),
+                    "tmp_name": tmp_name,
+                    "var_name": context.getConstantCode(constant=value_name.code_name),
+                }
+            )
 
         return tmp_name
 
@@ -170,6 +170,22 @@ template_read_mvar_unclear = """\
 %(tmp_name)s = LOOKUP_MODULE_VALUE(moduledict_%(module_identifier)s, %(var_name)s);
 """
 
+# With dictionary version tags, every read has its own cache, that is valid
+# until the module or built-in dictionary change. Names of built-ins also use
+# the module snapshot of built-in values, when that cache misses.
+template_read_mvar_cached = """\
+{
+    static struct Nuitka_ModuleVariableCache cache;
+    %(tmp_name)s = GET_MODULE_VARIABLE_VALUE_CACHED(moduledict_%(module_identifier)s, (Nuitka_StringObject *)%(var_name)s, &cache, %(builtins_snapshot)s, %(builtin_id)d);
+}
+"""
+
+template_module_builtins_snapshot = """\
+/* The snapshot of built-in values read by module code. */
+static PyObject *mod_builtins[%(builtins_count)d];
+static struct Nuitka_BuiltinsSnapshot mod_builtins_snapshot = {0, mod_builtins, %(builtins_count)d};
+"""
+
 template_read_locals_dict_with_fallback = """\
 %(to_name)s = DICT_GET_ITEM0(tstate, %(locals_dict)s, %(var_name)s);
 
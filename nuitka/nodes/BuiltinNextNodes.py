@@ -23,6 +23,8 @@
 
 from .ChildrenHavingMixins import ChildrenHavingIteratorDefaultMixin
 from .ExpressionBases import ExpressionBase, ExpressionBuiltinSingleArgBase
+from .shapes.BuiltinTypeShapes import tshape_int, tshape_xrange_iterator
+from .shapes.StandardShapes import tshape_unknown
 
 
 class ExpressionBuiltinNext1(ExpressionBuiltinSingleArgBase):
@@ -50,6 +52,13 @@ class ExpressionBuiltinNext1(ExpressionBuiltinSingleArgBase):
     def mayRaiseException(self, exception_type):
         return self.may_raise or self.subnode_value.mayRaiseException(exception_type)
 
+    def getTypeShape(self):
+        # Range iterators only ever produce "int" values.
+        if self.subnode_value.getTypeShape() is tshape_xrange_iterator:
+            return tshape_int
+
+        return tshape_unknown
+
 
 class ExpressionSpecialUnpack(ExpressionBuiltinNext1):
     __slots__ = ("count", "expected", "starred")
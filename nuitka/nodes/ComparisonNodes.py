@@ -31,9 +31,35 @@ from .NodeMakingHelpers import (
     makeRaiseExceptionReplacementExpressionFromInstance,
     wrapExpressionWithSideEffects,
 )
-from .shapes.BuiltinTypeShapes import tshape_bool, tshape_exception_class
+from .shapes.BuiltinTypeShapes import (
+    tshape_bool,
+    tshape_bytes,
+    tshape_exception_class,
+    tshape_int,
+    tshape_int_or_long,
+    tshape_long,
+    tshape_str,
+    tshape_unicode,
+)
 from .shapes.StandardShapes import tshape_unknown
 
+# Shapes of values, for which an ordering comparison is the inverse of the
+# negated other one. Not so for floats, where NaN compares false to anything,
+# nor for containers, which may contain them, nor for sets.
+_totally_ordered_shapes = frozenset(
+    shape
+    for shape in (
+        tshape_bool,
+        tshape_int,
+        tshape_long,
+        tshape_int_or_long,
+        tshape_str,
+        tshape_unicode,
+        tshape_bytes,
+    )
+    if shape is not None
+)
+
 
 class ExpressionComparisonBase(ChildrenHavingLeftRightMixin, ExpressionBase):
     named_children = ("left", "right")
@@ -86,8 +112,20 @@ class ExpressionComparisonBase(ChildrenHavingLeftRightMixin, ExpressionBase):
             source_ref=self.source_ref,
         )
 
+    def isInvertibleComparison(self):
+        if self.getTypeShape() is not tshape_bool:
+            return False
+
+        if self.comparator in ("Lt", "LtE", "Gt", "GtE"):
+            return (
+                self.subnode_left.getTypeShape() in _totally_ordered_shapes
+                and self.subnode_right.getTypeShape() in _totally_ordered_shapes
+            )
+
+        return True
+
     def computeExpressionOperationNot(self, not_node, trace_collection):
-        if self.getTypeShape() is tshape_bool:
+        if self.isInvertibleComparison():
             result = self.makeInverseComparison()
 
             result.copyTraceStateFrom(self)
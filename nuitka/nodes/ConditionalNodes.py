@@ -847,8 +847,9 @@ Empty 'yes' branch for conditional statement treated with inverted condition che
 
 
 def makeNotExpression(expression):
-    # These are invertible with bool type shape.
-    if expression.isExpressionComparison() and expression.getTypeShape() is tshape_bool:
+    # These are invertible with bool type shape, unless NaN floats may be
+    # ordered.
+    if expression.isExpressionComparison() and expression.isInvertibleComparison():
         return expression.makeInverseComparison()
     else:
         return ExpressionOperationNot(
@@ -48,6 +48,7 @@ class StatementLoop(StatementLoopBase):
 
     __slots__ = (
         "loop_variables",
+        "loop_scopes_complete",
         "loop_start",
         "loop_resume",
         "loop_previous_resume",
@@ -60,6 +61,10 @@ class StatementLoop(StatementLoopBase):
         # Variables used inside the loop.
         self.loop_variables = None
 
+        # Escapes of variables are only precise, once their scope is complete,
+        # until then the loop needs to start over.
+        self.loop_scopes_complete = False
+
         # Traces of the variable at the start of loop, to detect changes and make
         # those restart optimization.
         self.loop_start = {}
@@ -122,12 +127,17 @@ class StatementLoop(StatementLoopBase):
         # Look ahead. what will be written and degrade to initial loop traces
         # about that if we are in the first iteration, later we # will have more
         # precise knowledge.
-        if self.loop_variables is None:
+        if self.loop_variables is None or not self.loop_scopes_complete:
             self.loop_variables = OrderedSet()
             loop_body.collectVariableAccesses(
                 self.loop_variables.add, self.loop_variables.add
             )
 
+            self.loop_scopes_complete = all(
+                loop_variable.getOwner().locals_scope.complete
+                for loop_variable in self.loop_variables
+            )
+
             all_first_pass = True
         else:
             all_first_pass = False
@@ -45,6 +45,7 @@ from .shapes.ControlFlowDescriptions import (
     ControlFlowDescriptionFullEscape,
     ControlFlowDescriptionNoEscape,
 )
+from .shapes.BuiltinTypeShapes import tshape_float
 from .shapes.StandardShapes import tshape_iterator, tshape_unknown
 from .StatementBasesGenerated import (
     StatementAssignmentVariableConstantImmutableBase,
@@ -179,6 +180,18 @@ class StatementAssignmentVariableMixin(object):
         # is such a code for the type shape.
         return True
 
+    def _onVariableSetFromSource(self, trace_collection, source):
+        # Float values are immutable, so escaping them cannot change the value
+        # of the variable, which keeps its shape known.
+        if source.getTypeShape() is tshape_float:
+            return trace_collection.onVariableSetToUnescapableValue(
+                variable=self.variable, version=self.variable_version, assign_node=self
+            )
+        else:
+            return trace_collection.onVariableSet(
+                variable=self.variable, version=self.variable_version, assign_node=self
+            )
+
     def _transferState(self, result):
         self.variable_trace.assign_node = result
         result.variable_trace = self.variable_trace
@@ -405,9 +418,7 @@ Removed assignment of %s from itself which is known to be defined."""
 
         # Set-up the trace to the trace collection, so future references will
         # find this assignment.
-        self.variable_trace = trace_collection.onVariableSet(
-            variable=variable, version=self.variable_version, assign_node=self
-        )
+        self.variable_trace = self._onVariableSetFromSource(trace_collection, source)
 
         # TODO: Determine from future use of assigned variable, if this is needed at all.
         trace_collection.removeKnowledge(source)
@@ -1024,9 +1035,7 @@ Removed assignment of %s from itself which is known to be defined."""
 
         # Set-up the trace to the trace collection, so future references will
         # find this assignment.
-        self.variable_trace = trace_collection.onVariableSet(
-            variable=variable, version=self.variable_version, assign_node=self
-        )
+        self.variable_trace = self._onVariableSetFromSource(trace_collection, source)
 
         # TODO: Determine from future use of assigned variable, if this is needed at all.
         trace_collection.removeKnowledge(source)
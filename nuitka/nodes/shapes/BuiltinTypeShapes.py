@@ -19,6 +19,7 @@
 
 """
 
+from nuitka.code_generation.c_types.CTypeCFloats import CTypeCFloat
 from nuitka.code_generation.c_types.CTypeNuitkaBooleans import (
     CTypeNuitkaBoolEnum,
 )
@@ -683,6 +684,10 @@ class ShapeTypeFloat(ShapeNotContainerMixin, ShapeNumberMixin, ShapeBase):
 
     helper_code = "FLOAT"
 
+    @staticmethod
+    def getCType():
+        return CTypeCFloat
+
     add_shapes = add_shapes_float
     sub_shapes = sub_shapes_float
     mult_shapes = mult_shapes_float
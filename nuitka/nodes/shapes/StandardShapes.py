@@ -132,7 +132,7 @@ class ShapeBase(getMetaClassBase("Shape")):
                 return right_shape.getOperationBinaryAddLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryAddLShape(self)
 
             onMissingOperation("Add", self, right_shape)
 
@@ -155,7 +155,7 @@ class ShapeBase(getMetaClassBase("Shape")):
                     return right_shape.getOperationBinaryAddLShape(self)
 
                 if right_shape_type is ShapeLoopInitialAlternative:
-                    return operation_result_unknown
+                    return right_shape.getOperationBinaryAddLShape(self)
 
                 onMissingOperation("IAdd", self, right_shape)
 
@@ -179,7 +179,7 @@ class ShapeBase(getMetaClassBase("Shape")):
                 return right_shape.getOperationBinarySubLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinarySubLShape(self)
 
             onMissingOperation("Sub", self, right_shape)
 
@@ -198,7 +198,7 @@ class ShapeBase(getMetaClassBase("Shape")):
                 return right_shape.getOperationBinaryMultLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryMultLShape(self)
 
             onMissingOperation("Mult", self, right_shape)
 
@@ -255,7 +255,7 @@ class ShapeBase(getMetaClassBase("Shape")):
                 return right_shape.getOperationBinaryTrueDivLShape(self)
 
             if right_shape_type is ShapeLoopInitialAlternative:
-                return operation_result_unknown
+                return right_shape.getOperationBinaryTrueDivLShape(self)
 
             onMissingOperation("TrueDiv", self, right_shape)
 
@@ -694,10 +694,46 @@ class ShapeLoopInitialAlternative(ShapeBase):
             if entry is tshape_unknown:
                 return tshape_unknown
 
-            result.add(entry)
+            entry.emitAlternatives(result.add)
 
         return ShapeLoopInitialAlternative(result)
 
+    # Special methods to be called by other shapes encountering this type on
+    # the right side, only done for arithmetic, where loops matter most.
+    def getOperationBinaryAddLShape(self, left_shape):
+        assert left_shape is not tshape_unknown
+
+        return (
+            self._collectInitialShape(operation=left_shape.getOperationBinaryAddShape),
+            ControlFlowDescriptionFullEscape,
+        )
+
+    def getOperationBinarySubLShape(self, left_shape):
+        assert left_shape is not tshape_unknown
+
+        return (
+            self._collectInitialShape(operation=left_shape.getOperationBinarySubShape),
+            ControlFlowDescriptionFullEscape,
+        )
+
+    def getOperationBinaryMultLShape(self, left_shape):
+        assert left_shape is not tshape_unknown
+
+        return (
+            self._collectInitialShape(operation=left_shape.getOperationBinaryMultShape),
+            ControlFlowDescriptionFullEscape,
+        )
+
+    def getOperationBinaryTrueDivLShape(self, left_shape):
+        assert left_shape is not tshape_unknown
+
+        return (
+            self._collectInitialShape(
+                operation=left_shape.getOperationBinaryTrueDivShape
+            ),
+            ControlFlowDescriptionFullEscape,
+        )
+
     def getOperationBinaryAddShape(self, right_shape):
         if right_shape is tshape_unknown:
             return operation_result_unknown
@@ -32,7 +32,12 @@ Values can be seen as:
 * LoopComplete (complete knowledge of loop types)
 """
 
-from nuitka.nodes.shapes.BuiltinTypeShapes import tshape_dict, tshape_tuple
+from nuitka.nodes.shapes.BuiltinTypeShapes import (
+    tshape_dict,
+    tshape_float,
+    tshape_int,
+    tshape_tuple,
+)
 from nuitka.nodes.shapes.ControlFlowDescriptions import (
     ControlFlowDescriptionElementBasedEscape,
     ControlFlowDescriptionFullEscape,
@@ -471,6 +476,19 @@ class ValueTraceEscaped(ValueTraceUnknown):
     def getReplacementNode(self, usage):
         return self.previous.getReplacementNode(usage)
 
+    def getTypeShape(self):
+        # Escaping cannot change the type of immutable values, this also
+        # covers loop shapes, that are only made of these.
+        type_shape = self.previous.getTypeShape()
+
+        type_shapes = set()
+        type_shape.emitAlternatives(type_shapes.add)
+
+        if type_shapes in (set((tshape_float,)), set((tshape_int,))):
+            return type_shape
+        else:
+            return tshape_unknown
+
     @staticmethod
     def isUnknownTrace():
         return False
@@ -691,6 +709,7 @@ class ValueTraceMerge(ValueTraceMergeBase):
 
     def getTypeShape(self):
         type_shape_found = None
+        loop_initial = False
 
         for trace in self.previous:
             type_shape = trace.getTypeShape()
@@ -698,11 +717,26 @@ class ValueTraceMerge(ValueTraceMergeBase):
             if type_shape is tshape_unknown:
                 return tshape_unknown
 
+            if type(type_shape) is ShapeLoopInitialAlternative:
+                loop_initial = True
+
             if type_shape_found is None:
                 type_shape_found = type_shape
             elif type_shape is not type_shape_found:
-                # TODO: Find the lowest common denominator.
-                return tshape_unknown
+                type_shape_found = False
+
+        if type_shape_found is False:
+            # Inside loops not yet complete, keep the alternatives, so the
+            # loop can still converge to them.
+            if loop_initial:
+                type_shapes = set()
+                for trace in self.previous:
+                    trace.getTypeShape().emitAlternatives(type_shapes.add)
+
+                return ShapeLoopInitialAlternative(type_shapes)
+
+            # TODO: Find the lowest common denominator.
+            return tshape_unknown
 
         return type_shape_found
 
@@ -861,11 +895,15 @@ class ValueTraceLoopComplete(ValueTraceLoopBase):
             and self.type_shapes == other.type_shapes
         )
 
-    # TODO: These could be better
-    @staticmethod
-    def mustHaveValue():
-        return False
+    def mustHaveValue(self):
+        # Until the loop continue traces are added, only the entry into the
+        # loop is known, and code inside the loop might delete the value.
+        if len(self.previous) == 1:
+            return False
 
+        return ValueTraceLoopBase.mustHaveValue(self)
+
+    # TODO: These could be better
     @staticmethod
     def mustNotHaveValue():
         return False
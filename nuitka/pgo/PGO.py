@@ -30,6 +30,8 @@ _pgo_strings = None
 
 _module_entries = {}
 _module_exits = {}
+_function_calls = {}
+_branch_outcomes = {}
 
 
 def _readCString(input_file):
@@ -40,6 +42,10 @@ def _readCIntValue(input_file):
     return struct.unpack("i", input_file.read(4))[0]
 
 
+def _readCCounterValue(input_file):
+    return struct.unpack("Q", input_file.read(8))[0]
+
+
 def _readStringValue(input_file):
     return _pgo_strings[_readCIntValue(input_file)]
 
@@ -76,7 +82,7 @@ def readPGOInputFile(input_filename):
         _pgo_strings = [None] * count
 
         for i in xrange(count):
-            _pgo_strings[i] = _readCString(input_file)
+            _pgo_strings[i] = _readCString(input_file).decode("utf8")
 
         input_file.seek(7, os.SEEK_SET)
 
@@ -94,6 +100,15 @@ def readPGOInputFile(input_filename):
                 had_error = _readCIntValue(input_file) != 0
 
                 _module_exits[module_name] = had_error
+            elif probe_name == "FunctionCalls":
+                function_name = _readStringValue(input_file)
+                _function_calls[function_name] = _readCCounterValue(input_file)
+            elif probe_name == "BranchOutcomes":
+                branch_name = _readStringValue(input_file)
+                taken = _readCCounterValue(input_file)
+                not_taken = _readCCounterValue(input_file)
+
+                _branch_outcomes[branch_name] = taken, not_taken
             elif probe_name == "END":
                 break
             else:
@@ -148,3 +163,26 @@ def decideCompilationFromPGO(module_name):
         return "bytecode"
     else:
         return None
+
+
+def getFunctionCallCountFromPGO(module_name, function_qualname):
+    """Number of calls of a compiled function seen in the PGO run, or None."""
+
+    if not _pgo_active:
+        return None
+
+    return _function_calls.get("%s:%s" % (module_name, function_qualname), 0)
+
+
+def getBranchOutcomesFromPGO(module_name, line_number, probe_index):
+    """Taken and not taken counts for a branch seen in the PGO run, or None.
+
+    Several branches on one line are told apart by their probe index.
+    """
+
+    if not _pgo_active:
+        return None
+
+    return _branch_outcomes.get(
+        "%s:%d:%d" % (module_name, line_number, probe_index), (0, 0)
+    )
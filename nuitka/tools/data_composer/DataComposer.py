@@ -339,41 +339,69 @@ def _writeConstantStream(constants_reader):
     return count, struct.pack("H", count) + result.getvalue()
 
 
-crc32 = 0
+def _calcCRC32(data):
+    crc32 = binascii.crc32(data)
+
+    if str is bytes:
+        # Python2 is doing signed CRC32, but we want unsigned.
+        crc32 %= 1 << 32
+
+    return crc32
 
 
 def _writeConstantsBlob(output_filename, desc):
-    global crc32  # singleton, pylint: disable=global-statement
+    """Write the constants blob with a sorted directory at its head.
 
-    with open(output_filename, "w+b") as output:
-        output.write(b"\0" * 8)
+    The layout after the 8 bytes header (CRC32 and size of the directory)
+    is a count of entries, then fixed size directory entries of name offset,
+    data offset, data size, and CRC32 of the data, sorted by name, then the
+    name strings, and then the data of all the parts. That allows the loader
+    to binary search the directory and only touch and check the part of the
+    blob it needs.
+    """
 
-        def write(data):
-            global crc32  # singleton, pylint: disable=global-statement
+    desc = sorted(desc)
 
-            output.write(data)
-            crc32 = binascii.crc32(data, crc32)
+    directory_entry_size = struct.calcsize("IIII")
 
-        for name, part in desc:
-            write(name + b"\0")
-            write(struct.pack("I", len(part)))
-            write(part)
+    names_offset = 4 + len(desc) * directory_entry_size
+    data_offset = names_offset + sum(len(name) + 1 for name, _part in desc)
 
-        data_size = output.tell() - 8
+    directory = BytesIO()
+    directory.write(struct.pack("I", len(desc)))
+
+    names = []
+
+    for name, part in desc:
+        directory.write(
+            struct.pack("IIII", names_offset, data_offset, len(part), _calcCRC32(part))
+        )
+        names.append(name + b"\0")
 
-        if str is bytes:
-            # Python2 is doing signed CRC32, but we want unsigned.
-            crc32 %= 1 << 32
+        names_offset += len(name) + 1
+        data_offset += len(part)
 
-        output.seek(0)
-        output.write(struct.pack("II", crc32, data_size))
+    directory.write(b"".join(names))
+    directory = directory.getvalue()
 
-        assert output.tell() == 8
+    directory_crc32 = _calcCRC32(directory)
+
+    with open(output_filename, "wb") as output:
+        output.write(struct.pack("II", directory_crc32, len(directory)))
+        output.write(directory)
+
+        for _name, part in desc:
+            output.write(part)
+
+        data_size = output.tell() - 8
+        assert data_size == data_offset, (data_size, data_offset)
 
         data_composer_logger.info(
             "Total constants blob size without header %d." % data_size
         )
-        data_composer_logger.info("Total constants blob CRC32 is %d." % crc32)
+        data_composer_logger.info(
+            "Total constants blob directory CRC32 is %d." % directory_crc32
+        )
 
         syncFileOutput(output)
 
@@ -24,6 +24,7 @@ import shutil
 import struct
 import sys
 from contextlib import contextmanager
+from io import BytesIO
 
 from nuitka.__past__ import to_byte
 from nuitka.Progress import (
@@ -88,6 +89,7 @@ def _attachOnefilePayloadFile(
     filename_encoding,
     file_checksums,
     win_path_sep,
+    payload_hash,
 ):
     # Somewhat detail rich, at least unless we make more things mandatory, and
     # we also need to pass all modes, since this can be run in a separate process
@@ -113,6 +115,7 @@ def _attachOnefilePayloadFile(
 
     output_file.write(filename_encoded)
     payload_item_size += len(filename_encoded)
+    payload_hash.updateFromBytes(filename_encoded)
 
     file_flags = 0
     if not isWin32OrPosixWindows() and os.path.islink(filename_full):
@@ -128,6 +131,7 @@ def _attachOnefilePayloadFile(
 
         output_file.write(link_target_encoded)
         payload_item_size += len(link_target_encoded)
+        payload_hash.updateFromBytes(file_header + link_target_encoded)
     else:
         # This flag is only relevant for non-links.
         if not isWin32OrPosixWindows() and os.access(filename_full, os.X_OK):
@@ -174,6 +178,9 @@ def _attachOnefilePayloadFile(
             output_file.write(file_header)
             payload_item_size += len(file_header)
 
+            # With file checksums, the headers describe the contents fully.
+            payload_hash.updateFromBytes(file_header)
+
             if is_archive and is_compressing:
                 with open(compression_cache_filename, "rb") as archive_entry_file:
                     pos1 = output_file.tell()
@@ -198,6 +205,29 @@ def _attachOnefilePayloadFile(
     return payload_item_size
 
 
+# Uncompressed size of files, after which a new group of the compressed stream
+# is started. Groups are decompressed in parallel, but compress less well.
+_payload_group_size = 8 * 1024 * 1024
+
+
+def _getPayloadGroups(files):
+    group = []
+    group_size = 0
+
+    for count, filename_full in files:
+        group.append((count, filename_full))
+        group_size += os.lstat(filename_full).st_size
+
+        if group_size >= _payload_group_size:
+            yield group
+
+            group = []
+            group_size = 0
+
+    if group:
+        yield group
+
+
 def _getCacheFilename(binary_filename, low_memory):
     hash_value = Hash()
 
@@ -249,6 +279,13 @@ def attachOnefilePayload(
             start_pos = output_file.tell()
             output_file.write(b"KA" + compression_indicator)
 
+            # Without temporary directory, the payload hash follows, but it
+            # is only known at the end, so write a placeholder for now.
+            payload_hash = HashCRC32()
+
+            if file_checksums:
+                output_file.write(struct.pack("I", 0))
+
             # Move the binary to start immediately to the start position
             file_list = getFileList(dist_dir, normalize=False)
             file_list.remove(start_binary)
@@ -285,10 +322,12 @@ def attachOnefilePayload(
 
                 is_archive = False
 
-            with overall_compressor(output_file) as compressed_file:
-                for count, filename_full in enumerate(file_list, start=1):
-                    payload_size += _attachOnefilePayloadFile(
-                        output_file=compressed_file,
+            def _attachOnefilePayloadFiles(target_file, files):
+                result = 0
+
+                for count, filename_full in files:
+                    result += _attachOnefilePayloadFile(
+                        output_file=target_file,
                         is_archive=is_archive,
                         file_compressor=file_compressor,
                         is_compressing=compression_indicator == b"Y",
@@ -300,14 +339,45 @@ def attachOnefilePayload(
                         filename_encoding=filename_encoding,
                         file_checksums=file_checksums,
                         win_path_sep=win_path_sep,
+                        payload_hash=payload_hash,
                     )
 
                 # Using empty filename as a terminator.
                 filename_encoded = "\0".encode(filename_encoding)
-                compressed_file.write(filename_encoded)
-                payload_size += len(filename_encoded)
+                target_file.write(filename_encoded)
+
+                return result + len(filename_encoded)
+
+            files = list(enumerate(file_list, start=1))
+
+            if compression_indicator == b"Y" and not is_archive:
+                # Groups of files are compressed as independent frames, such
+                # that the bootstrap can decompress them in parallel. Each
+                # frame is prefixed with its size, and a zero size ends them.
+                compressed_size = 0
+
+                for group in _getPayloadGroups(files):
+                    group_file = BytesIO()
+
+                    with overall_compressor(group_file) as compressed_file:
+                        payload_size += _attachOnefilePayloadFiles(
+                            target_file=compressed_file, files=group
+                        )
 
-                compressed_size = compressed_file.tell()
+                    group_data = group_file.getvalue()
+
+                    output_file.write(struct.pack("I", len(group_data)))
+                    output_file.write(group_data)
+                    compressed_size += len(group_data)
+
+                output_file.write(struct.pack("I", 0))
+            else:
+                with overall_compressor(output_file) as compressed_file:
+                    payload_size += _attachOnefilePayloadFiles(
+                        target_file=compressed_file, files=files
+                    )
+
+                    compressed_size = compressed_file.tell()
 
             if compression_indicator == b"Y":
                 onefile_logger.info(
@@ -335,6 +405,12 @@ def attachOnefilePayload(
             # jump directly to it.
             output_file.write(struct.pack("Q", end_pos - start_pos))
 
+        if file_checksums:
+            # Appending file mode cannot overwrite, so patch it separately.
+            with open(onefile_output_filename, "r+b") as output_file:
+                output_file.seek(start_pos + 3, 0)
+                output_file.write(struct.pack("I", payload_hash.asDigest()))
+
         closeProgressBar()
 
     _attachOnefilePayload()
@@ -38,3 +38,47 @@ def yieldExceptionInteraction():
 
 
 yieldExceptionInteraction()
+
+print("Testing swallowed exceptions:")
+
+
+def swallowedExceptionAsName(d):
+    try:
+        d["x"]
+    except KeyError as e:
+        saved = e
+
+    return saved
+
+
+print("Swallowed exception bound to name", repr(swallowedExceptionAsName({})))
+
+
+def swallowedExceptionNested(d):
+    try:
+        raise ValueError("outer")
+    except ValueError:
+        try:
+            d["x"]
+        except KeyError:
+            pass
+
+        print("After nested swallowed handler", sys.exc_info()[0])
+
+    print("After outer handler", sys.exc_info()[0])
+
+
+swallowedExceptionNested({})
+
+
+def swallowedExceptionMismatch(d):
+    try:
+        d.x
+    except KeyError:
+        pass
+
+
+try:
+    swallowedExceptionMismatch({})
+except AttributeError as e:
+    print("Not swallowed exception propagated", type(e), sys.exc_info()[0])
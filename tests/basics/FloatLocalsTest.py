@@ -0,0 +1,150 @@
+#     Copyright 2023, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+""" Float local variables, that Nuitka can unbox to C double values.
+
+"""
+
+from __future__ import print_function
+
+import sys
+
+
+def floatLoop(count):
+    zr = 0.0
+    zi = 0.0
+
+    for _x in range(count):
+        tr = zr * zr - zi * zi + 0.25
+        ti = 2.0 * zr * zi + 0.5
+        zr = tr
+        zi = ti
+
+        if zr * zr + zi * zi > 4.0:
+            zr = 0.0
+            zi = 0.0
+
+    return zr, zi
+
+
+print("Float loop result", floatLoop(100))
+
+
+def floatLoopWhile():
+    value = 1.0
+    steps = 0
+
+    while value < 1000.0:
+        value = value * 1.5 + 1
+        steps += 1
+
+    print("Float while loop", value, steps)
+
+
+floatLoopWhile()
+
+
+def floatSpecialValues(count):
+    inf = 1e308
+    neg_zero = -1.0
+
+    for _x in range(count):
+        inf = inf * 10.0
+        neg_zero = neg_zero * 0.0
+
+    nan = inf - inf
+
+    print("Float special values", inf, nan, neg_zero)
+    print("NaN comparisons", nan < 1.0, nan >= 1.0, nan == nan, nan != nan)
+    print("Negative zero compares equal", neg_zero == 0.0)
+
+
+floatSpecialValues(2)
+
+
+def floatGenerator(count):
+    value = 0.5
+
+    for _x in range(count):
+        value = value * 2.0 + 0.25
+
+        # The value must survive the suspension.
+        yield count
+
+    yield value
+
+
+print("Float generator across yields", list(floatGenerator(5)))
+
+
+def floatGeneratorYielded(count):
+    value = 0.5
+
+    for _x in range(count):
+        yield value
+        value = value * 2.0 + 0.25
+
+
+print("Float generator yielding values", list(floatGeneratorYielded(5)))
+
+
+def floatEscapes(count):
+    other = 0.0
+
+    for _x in range(count):
+        other = other + 1.5
+
+        # Passed as argument, needs the object.
+        print("Float escapes as argument", other, type(other))
+
+    print("Float escapes into containers", [other], {"key": other}, (other,))
+
+    return other
+
+
+print("Float escapes as return value", floatEscapes(3))
+
+
+def floatLocals(count):
+    value = 2.5
+    other = 0.0
+
+    for _x in range(count):
+        other = other - value
+
+    print("Float locals", sorted(locals().items()))
+
+
+floatLocals(2)
+
+
+def floatTraceback(count):
+    value = 3.5
+    other = 1.0
+
+    for _x in range(count):
+        other = other * value
+
+    raise ValueError(other)
+
+
+try:
+    floatTraceback(2)
+except ValueError:
+    frame = sys.exc_info()[2].tb_next.tb_frame
+
+    print("Float traceback locals", frame.f_locals["other"])
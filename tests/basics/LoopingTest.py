@@ -156,3 +156,24 @@ def loopingFunction(a=1 * 2):
 
 
 loopingFunction()
+
+
+def loopDeletingVariable():
+    x = 1
+    result = []
+
+    for i in range(3):
+        try:
+            y = x
+        except UnboundLocalError:
+            y = "unbound"
+
+        result.append(y)
+
+        if i == 0:
+            del x
+
+    print("Variable deleted in loop", result)
+
+
+loopDeletingVariable()
@@ -90,3 +90,37 @@ try:
     x = value[1]
 except Exception as e:
     print("Indexing None gives", repr(e))
+
+print("Negated comparisons with NaN floats:")
+
+
+def negatedFloatComparisons(a, b):
+    x = float(a)
+    y = float(b)
+
+    for _i in range(2):
+        print(not (x < y), not (x <= y), not (x > y), not (x >= y))
+
+        if x >= y:
+            pass
+        else:
+            print("Not greater or equal")
+
+        x = x + 1.0
+
+
+def negatedFloatComparisonsAfterLoop():
+    x = 1.0
+    y = float("nan")
+
+    for _i in range(2):
+        x = x + 1.0
+
+    return not (x >= y), not (x < y), not (y <= x), not (y > x)
+
+
+print(negatedFloatComparisonsAfterLoop())
+negatedFloatComparisons(1, "nan")
+negatedFloatComparisons("nan", 1)
+negatedFloatComparisons(1, 2)
+print(not ([float("nan")] < [float("nan")]), not ({1} <= {2}))
@@ -0,0 +1,148 @@
+#     Copyright 2023, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Python tests originally created or extracted from other peoples work. The
+#     parts were too small to be protected.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+""" Int local variables from "range" loops, that Nuitka can unbox to C long values.
+
+"""
+
+from __future__ import print_function
+
+import sys
+
+
+def rangeLoop():
+    total = 0
+
+    for x in range(10):
+        for y in range(-5, 5):
+            if x * y > 6:
+                total = total + x * y - y
+
+    return total
+
+
+print("Range loop result", rangeLoop())
+
+
+def rangeLoopStep():
+    values = []
+
+    for x in range(100, -100, -7):
+        if x % 3 == 0 or x < -90:
+            values.append(x)
+
+    return values
+
+
+print("Range loop with step", rangeLoopStep())
+
+
+def rangeLoopEmpty():
+    count = 0
+
+    for x in range(10, 0):
+        count = count + x
+
+    return count
+
+
+print("Range loop empty", rangeLoopEmpty())
+
+
+def rangeLoopTruth():
+    result = []
+
+    for x in range(-2, 3):
+        if x:
+            result.append(x)
+        else:
+            result.append("zero")
+
+    return result
+
+
+print("Range loop truth values", rangeLoopTruth())
+
+
+def rangeLoopLimits():
+    # Products of these do not fit into 32 bits C long, must be done as
+    # objects, and still give correct results.
+    result = []
+
+    for x in range(2**31 - 3, 2**31):
+        result.append(x * x)
+        result.append(x + x)
+        result.append(-x - x)
+
+    for x in range(2**62, 2**62 + 2):
+        result.append(x * 4)
+
+    return result
+
+
+print("Range loop limits", rangeLoopLimits())
+
+
+def rangeGenerator():
+    for x in range(5):
+        y = x * 3
+
+        # The values must survive the suspension.
+        yield "value"
+
+        yield x + y
+
+
+print("Range generator across yields", list(rangeGenerator()))
+
+
+def rangeEscapes():
+    for x in range(3):
+        # Passed as argument, needs the object.
+        print("Range escapes as argument", x, type(x))
+
+    print("Range escapes into containers", [x], {"key": x}, (x,))
+
+    return x * 7
+
+
+print("Range escapes as return value", rangeEscapes())
+
+
+def rangeLocals():
+    for x in range(3):
+        y = x - 1
+
+    print("Range locals", sorted(locals().items()))
+
+
+rangeLocals()
+
+
+def rangeTraceback():
+    for x in range(4):
+        y = x * x
+
+    raise ValueError(y)
+
+
+try:
+    rangeTraceback()
+except ValueError:
+    frame = sys.exc_info()[2].tb_next.tb_frame
+
+    print("Range traceback locals", sorted(frame.f_locals.items()))
@@ -0,0 +1,113 @@
+//     Copyright 2023, Kay Hayen, mailto:kay.hayen@gmail.com
+//
+//     Part of "Nuitka", an optimizing Python compiler that is compatible and
+//     integrates with CPython, but also works on its own.
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+/* Micro benchmark for the CRC32 implementations used by the constants blob
+ * and the onefile bootstrap. Checks the paths against each other and reports
+ * the throughput of each in GB/s. Build it from the top level directory with:
+ *
+ *     gcc -O2 -I nuitka/build/static_src -I nuitka/build/inline_copy/zlib \
+ *         tests/benchmarks/checksums/Crc32Throughput.c -o crc32-throughput
+ *
+ * Add "-D_NUITKA_USE_OWN_CRC32" to measure the fallback without zlib.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "HelpersChecksumTools.c"
+
+typedef uint32_t (*crc32_bench_func_t)(uint32_t crc, unsigned char const *message, uint32_t size);
+
+static double getSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static bool checkAgainstGeneric(crc32_bench_func_t func, unsigned char const *buffer) {
+    // Cover small sizes, all alignments, and the tails after the folding.
+    for (uint32_t offset = 0; offset < 16; offset++) {
+        for (uint32_t size = 0; size < 1024; size++) {
+            if (func(0, buffer + offset, size) != _calcCRC32Generic(0, buffer + offset, size)) {
+                printf("Mismatch for offset %u size %u\n", offset, size);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static void benchmark(char const *name, crc32_bench_func_t func, unsigned char const *buffer, uint32_t size,
+                      int rounds) {
+    uint32_t result = 0;
+
+    double start = getSeconds();
+
+    for (int i = 0; i < rounds; i++) {
+        result ^= func(0, buffer, size);
+    }
+
+    double elapsed = getSeconds() - start;
+
+    printf("%-10s %8.3f GB/s (result %08x)\n", name, (double)size * rounds / elapsed / 1e9, result);
+}
+
+int main(int argc, char **argv) {
+    uint32_t size = 64 * 1024 * 1024;
+    int rounds = argc > 1 ? atoi(argv[1]) : 10;
+
+    unsigned char *buffer = (unsigned char *)malloc(size + 16);
+
+    srand(42);
+    for (uint32_t i = 0; i < size + 16; i++) {
+        buffer[i] = (unsigned char)rand();
+    }
+
+#ifdef _NUITKA_USE_OWN_CRC32
+    benchmark("own", _calcCRC32Generic, buffer, size, rounds);
+#else
+    benchmark("zlib", _calcCRC32Generic, buffer, size, rounds);
+#endif
+
+#if _NUITKA_HARDWARE_CRC32_PCLMUL || _NUITKA_HARDWARE_CRC32_ARMV8
+    if (_hasHardwareCRC32()) {
+        if (checkAgainstGeneric(_calcCRC32Hardware, buffer) == false) {
+            return 1;
+        }
+
+#if _NUITKA_HARDWARE_CRC32_PCLMUL
+        benchmark("pclmul", _calcCRC32Hardware, buffer, size, rounds);
+#else
+        benchmark("armv8-crc", _calcCRC32Hardware, buffer, size, rounds);
+#endif
+    } else {
+        puts("No hardware CRC32 support on this CPU.");
+    }
+#else
+    puts("No hardware CRC32 support for this platform or compiler.");
+#endif
+
+    free(buffer);
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+#     Copyright 2023, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Python test originally created or extracted from other peoples work. The
+#     parts from me are licensed as below. It is at least Free Software where
+#     it's copied from other people. In these cases, that will normally be
+#     indicated.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#         http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+import itertools
+
+
+async def someCoroutine(a, b):
+    return a + b
+
+
+def someGenerator(a, b):
+    yield a + b
+
+
+async def someLargeCoroutine(a, b):
+    # Many locals live across the await, and need heap storage in the object.
+    c1 = a + b
+    c2 = c1 + a
+    c3 = c2 + b
+    c4 = c3 + c1
+    c5 = c4 + c2
+    c6 = c5 + c3
+    c7 = c6 + c4
+    c8 = c7 + c5
+    c9 = c8 + c6
+    c10 = c9 + c7
+    c11 = c10 + c8
+    c12 = c11 + c9
+
+    await someCoroutine(a, b)
+
+    return c1 + c2 + c3 + c4 + c5 + c6 + c7 + c8 + c9 + c10 + c11 + c12
+
+
+def someLargeGenerator(a, b):
+    # Many locals live across the yield, and need heap storage in the object.
+    c1 = a + b
+    c2 = c1 + a
+    c3 = c2 + b
+    c4 = c3 + c1
+    c5 = c4 + c2
+    c6 = c5 + c3
+    c7 = c6 + c4
+    c8 = c7 + c5
+    c9 = c8 + c6
+    c10 = c9 + c7
+    c11 = c10 + c8
+    c12 = c11 + c9
+
+    yield a + b
+
+    yield c1 + c2 + c3 + c4 + c5 + c6 + c7 + c8 + c9 + c10 + c11 + c12
+
+
+def calledRepeatedly():
+    # We measure creating and discarding coroutine or generator objects of a
+    # small and a large heap size, both go through the compiled object free
+    # lists of their size class.
+    # construct_begin
+    coro = someCoroutine(1, 2)
+    coro.close()
+    coro = someLargeCoroutine(1, 2)
+    coro.close()
+    # construct_alternative
+    coro = someGenerator(1, 2)
+    coro.close()
+    coro = someLargeGenerator(1, 2)
+    coro.close()
+    # construct_end
+
+    return coro
+
+
+for x in itertools.repeat(None, 50000):
+    calledRepeatedly()
+
+print("OK.")
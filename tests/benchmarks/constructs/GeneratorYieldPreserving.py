@@ -0,0 +1,51 @@
+#     Copyright 2023, Kay Hayen, mailto:kay.hayen@gmail.com
+#
+#     Python test originally created or extracted from other peoples work. The
+#     parts from me are licensed as below. It is at least Free Software where
+#     it's copied from other people. In these cases, that will normally be
+#     indicated.
+#
+#     Licensed under the Apache License, Version 2.0 (the "License");
+#     you may not use this file except in compliance with the License.
+#     You may obtain a copy of the License at
+#
+#         http://www.apache.org/licenses/LICENSE-2.0
+#
+#     Unless required by applicable law or agreed to in writing, software
+#     distributed under the License is distributed on an "AS IS" BASIS,
+#     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#     See the License for the specific language governing permissions and
+#     limitations under the License.
+#
+import itertools
+
+items = ["ab", "cd", "ef"]
+
+
+def calledRepeatedly():
+    # We measure a yield inside an expression, where the temporary values
+    # around it must be preserved and restored, or a plain yield.
+    def generator():
+        for item in items:
+            try:
+                # construct_begin
+                x = len(item) + (yield item) + len(item)
+                # construct_alternative
+                x = yield item
+                # construct_end
+            except KeyError:
+                yield x
+
+    gen = generator()
+
+    x = next(gen)
+    gen.send(1)
+    gen.send(2)
+
+    return x
+
+
+for x in itertools.repeat(None, 50000):
+    calledRepeatedly()
+
+print("OK.")